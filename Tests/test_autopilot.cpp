@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "../include/Autopilot.h"
+#include "../include/BalanceSim.h"
+
+// Submarine is 112x112 at (200, 275): center (256, 331)
+
+TEST(AutopilotTest, HeadsForNearestLitter) {
+    Simulation sim;
+    sim.getLevel().setLitterItems({ Litter(SPRITE_CAN, 600.0f, 100.0f, 1.5f, 40, 40),
+                                    Litter(SPRITE_CAN, 400.0f, 500.0f, 1.5f, 40, 40) });
+
+    SimInput input = Autopilot::decide(sim);
+    EXPECT_TRUE(input.right && input.down);
+    EXPECT_FALSE(input.left || input.up || input.calm);
+}
+
+TEST(AutopilotTest, IgnoresLitterNotOnScreenYet) {
+    Simulation sim;
+    sim.getLevel().setLitterItems({ Litter(SPRITE_CAN, 900.0f, 331.0f, 1.5f, 40, 40),
+                                    Litter(SPRITE_CAN, 100.0f, 80.0f, 1.5f, 40, 40) });
+
+    SimInput input = Autopilot::decide(sim);
+    EXPECT_TRUE(input.left && input.up);
+}
+
+TEST(AutopilotTest, CalmsAndDodgesCloseAnimals) {
+    Simulation sim;
+    sim.getLevel().setLitterItems({});
+    // Swordfish in our lane, just to the right and a little above
+    sim.getLevel().setEnemyItems({ Enemies(SPRITE_SWORDFISH, 316.0f, 286.0f, 6.0f, 70, 50, 0) });
+
+    SimInput input = Autopilot::decide(sim);
+    EXPECT_TRUE(input.calm);
+    EXPECT_TRUE(input.down);
+    EXPECT_FALSE(input.up);
+}
+
+TEST(AutopilotTest, DodgesCalmedAnimalsWithoutCalmingAgain) {
+    Simulation sim;
+    sim.getLevel().setLitterItems({});
+    Enemies calmed(SPRITE_EEL, 316.0f, 350.0f, 6.0f, 70, 30, 1);
+    calmed.calmed = true;
+    sim.getLevel().setEnemyItems({ calmed });
+
+    SimInput input = Autopilot::decide(sim);
+    EXPECT_FALSE(input.calm);
+    EXPECT_TRUE(input.up);
+}
+
+TEST(AutopilotTest, KeepsSharksAtADistance) {
+    Simulation sim;
+    sim.getLevel().setLitterItems({});
+    // Up and to the right, outside the normal avoid radius but inside the
+    // shark one (sharks are drawn 1.5x: 90x60)
+    sim.getLevel().setEnemyItems({ Enemies(SPRITE_SHARK, 256.0f + 200.0f - 45.0f, 331.0f - 80.0f - 30.0f, 4.0f, 60, 40, 4) });
+
+    SimInput input = Autopilot::decide(sim);
+    EXPECT_FALSE(input.calm);
+    EXPECT_TRUE(input.down);
+}
+
+TEST(AutopilotTest, ReachesTheStormAndWinsGames) {
+    int reachedStorm = 0, wins = 0;
+    for (uint64_t seed = 1; seed <= 20; seed++) {
+        BalanceSim::RunStats r = BalanceSim::runGame(SimConfig(), seed, BalanceSim::Policy::Autopilot, 60 * 60 * 3);
+        reachedStorm += r.levelTicks[2] > 0;
+        wins += r.victory;
+    }
+    EXPECT_GE(reachedStorm, 16);
+    EXPECT_GE(wins, 8);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "../include/BalanceSim.h"
+
+TEST(BalanceSimTest, ChaseBotReachesThresholdsInOrder) {
+    BalanceSim::RunStats r = BalanceSim::runGame(SimConfig(), 5, BalanceSim::Policy::Chase, 60 * 60 * 5);
+
+    EXPECT_EQ(r.seed, 5u);
+    EXPECT_GT(r.litterCollected, 10);
+    ASSERT_GT(r.levelTicks[0], 0);
+    EXPECT_GT(r.levelTicks[1], r.levelTicks[0]);
+    EXPECT_TRUE(r.victory || r.gameOver || r.ticks == 60 * 60 * 5);
+
+    int lives = 0;
+    for (int lost : r.livesLost) lives += lost;
+    if (r.gameOver) {
+        EXPECT_EQ(lives, 3);
+    }
+    if (r.finalLevel == 4) {
+        EXPECT_EQ(r.level4Score, r.finalScore);
+    }
+}
+
+TEST(BalanceSimTest, IdleGameRunsOutTheClock) {
+    BalanceSim::RunStats r = BalanceSim::runGame(SimConfig(), 1, BalanceSim::Policy::Idle, 600);
+
+    // Level 1 has no animals, so sitting still just lets litter go by
+    EXPECT_EQ(r.ticks, 600);
+    EXPECT_FALSE(r.victory || r.gameOver);
+    EXPECT_EQ(r.levelTicks[0], -1);
+    EXPECT_EQ(r.level4Score, -1);
+}
+
+TEST(BalanceSimTest, BatchDoesNotDependOnThreadCount) {
+    BalanceSim::Options options;
+    options.runs = 24;
+    options.seed = 100;
+    options.maxTicks = 60 * 60;
+
+    options.threads = 1;
+    std::vector<BalanceSim::RunStats> serial = BalanceSim::runBatch(options);
+    options.threads = 4;
+    std::vector<BalanceSim::RunStats> parallel = BalanceSim::runBatch(options);
+
+    std::ostringstream a, b;
+    BalanceSim::writeCsv(a, serial);
+    BalanceSim::writeCsv(b, parallel);
+    EXPECT_EQ(a.str(), b.str());
+
+    ASSERT_EQ(serial.size(), 24u);
+    for (int i = 0; i < 24; i++) EXPECT_EQ(serial[i].seed, 100u + i);
+}
+
+TEST(BalanceSimTest, ConfigChangesTheGame) {
+    // Nothing spawns in Levels 2-3 with room for zero animals
+    SimConfig calm;
+    calm.maxActiveEnemies = 0;
+    calm.stormMaxActiveEnemies = 0;
+    BalanceSim::RunStats r = BalanceSim::runGame(calm, 3, BalanceSim::Policy::Chase, 60 * 60 * 3);
+
+    for (int lost : r.livesLost) EXPECT_EQ(lost, 0);
+    EXPECT_TRUE(r.victory);
+}
+
+TEST(BalanceSimTest, CsvHasOneRowPerRun) {
+    std::vector<BalanceSim::RunStats> runs(3);
+    runs[1].levelTicks[0] = 120;
+    std::ostringstream out;
+    BalanceSim::writeCsv(out, runs);
+
+    std::istringstream lines(out.str());
+    std::string header, row0, row1;
+    std::getline(lines, header);
+    std::getline(lines, row0);
+    std::getline(lines, row1);
+    EXPECT_EQ(header.rfind("seed,seconds,level2_s,level3_s,level4_s,lives_lost_swordfish", 0), 0u);
+    EXPECT_EQ(row0.rfind("0,0,,,,", 0), 0u);   // Thresholds never reached are left empty
+    EXPECT_EQ(row1.rfind("0,0,2,,,", 0), 0u);
+}
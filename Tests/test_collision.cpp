@@ -2,6 +2,10 @@
 #include <gmock/gmock.h>
 #include <SDL.h>
 #include "test_mocks.h"
+#include "../include/SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 
 using ::testing::Return;
 using ::testing::_;
@@ -156,3 +160,124 @@ TEST(RectFactoryTest, DefaultPositions) {
     EXPECT_EQ(sub.x, 100);
     EXPECT_EQ(lit.x, 300);
 }
+
+//  SPATIAL GRID TESTS
+
+TEST(SpatialGridTest, RectQueryFindsOverlaps) {
+    SpatialGrid grid;
+    grid.insert(0, { 100, 100, 40, 40 });
+    grid.insert(1, { 600, 400, 40, 40 });
+    grid.insert(2, { 130, 130, 200, 20 });   // Spans several cells
+
+    std::vector<int> hits;
+    grid.queryRect({ 120, 120, 20, 20 }, hits);
+    std::sort(hits.begin(), hits.end());
+    EXPECT_EQ(hits, (std::vector<int>{ 0, 2 }));
+
+    // Touching edges don't count, like rectsOverlap
+    grid.queryRect({ 140, 100, 10, 10 }, hits);
+    EXPECT_TRUE(hits.empty());
+
+    // Cleared grid finds nothing
+    grid.clear();
+    grid.queryRect({ 0, 0, 800, 600 }, hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST(SpatialGridTest, OffScreenEntitiesStillFound) {
+    SpatialGrid grid;
+    grid.insert(0, { 5000, -3000, 50, 50 });  // Way past the grid bounds
+    grid.insert(1, { -120, 300, 50, 50 });
+
+    std::vector<int> hits;
+    grid.queryRect({ 5010, -2990, 10, 10 }, hits);
+    EXPECT_EQ(hits, (std::vector<int>{ 0 }));
+    grid.queryRect({ -110, 310, 10, 10 }, hits);
+    EXPECT_EQ(hits, (std::vector<int>{ 1 }));
+}
+
+TEST(SpatialGridTest, MatchesBruteForce) {
+    srand(1234);
+    std::vector<SimRect> rects;
+    SpatialGrid grid;
+    for (int i = 0; i < 500; i++) {
+        SimRect r = { rand() % 1100 - 150, rand() % 800 - 100, 10 + rand() % 80, 10 + rand() % 80 };
+        rects.push_back(r);
+        grid.insert(i, r);
+    }
+
+    std::vector<int> hits;
+    for (int q = 0; q < 200; q++) {
+        SimRect area = { rand() % 900 - 50, rand() % 700 - 50, 20 + rand() % 150, 20 + rand() % 150 };
+        std::vector<int> expected;
+        for (int i = 0; i < (int)rects.size(); i++) {
+            if (rectsOverlap(area, rects[i])) expected.push_back(i);
+        }
+        grid.queryRect(area, hits);
+        std::sort(hits.begin(), hits.end());
+        EXPECT_EQ(hits, expected);
+
+        float cx = float(rand() % 800), cy = float(rand() % 600), radius = float(rand() % 200);
+        expected.clear();
+        for (int i = 0; i < (int)rects.size(); i++) {
+            float dx = rects[i].x + rects[i].w / 2.0f - cx;
+            float dy = rects[i].y + rects[i].h / 2.0f - cy;
+            if (dx * dx + dy * dy <= radius * radius) expected.push_back(i);
+        }
+        grid.queryRadius(cx, cy, radius, hits);
+        std::sort(hits.begin(), hits.end());
+        EXPECT_EQ(hits, expected);
+    }
+}
+
+TEST(SpatialGridTest, InPlaceUpdatesMatchBruteForce) {
+    srand(99);
+    std::vector<SimRect> rects;
+    std::vector<bool> present;
+    SpatialGrid grid;
+    for (int i = 0; i < 300; i++) {
+        SimRect r = { rand() % 1100 - 150, rand() % 800 - 100, 10 + rand() % 80, 10 + rand() % 80 };
+        rects.push_back(r);
+        present.push_back(true);
+        grid.insert(i, r);
+    }
+
+    std::vector<int> hits;
+    for (int tick = 0; tick < 50; tick++) {
+        // Small moves (mostly the same cells), a few jumps, some taken out and put back
+        for (int i = 0; i < (int)rects.size(); i++) {
+            int roll = rand() % 100;
+            if (roll < 5) {
+                present[i] = !present[i];
+                if (present[i]) grid.insert(i, rects[i]);
+                else grid.remove(i);
+                continue;
+            }
+            if (!present[i]) continue;
+            if (roll < 10) {
+                rects[i].x = rand() % 1100 - 150;
+                rects[i].y = rand() % 800 - 100;
+            } else {
+                rects[i].x += rand() % 11 - 5;
+                rects[i].y += rand() % 11 - 5;
+            }
+            grid.insert(i, rects[i]);
+        }
+
+        SimRect area = { rand() % 900 - 50, rand() % 700 - 50, 20 + rand() % 150, 20 + rand() % 150 };
+        std::vector<int> expected;
+        for (int i = 0; i < (int)rects.size(); i++) {
+            if (present[i] && rectsOverlap(area, rects[i])) expected.push_back(i);
+        }
+        grid.queryRect(area, hits);
+        std::sort(hits.begin(), hits.end());
+        EXPECT_EQ(hits, expected) << "tick " << tick;
+    }
+
+    // Removing twice, or something never added, is harmless
+    grid.remove(0);
+    grid.remove(0);
+    grid.remove(5000);
+    grid.queryRect({ -1000, -1000, 3000, 3000 }, hits);
+    for (int id : hits) EXPECT_NE(id, 0);
+}
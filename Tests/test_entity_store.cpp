@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "../include/EntityStore.h"
+#include "../include/Level.h"
+
+//  STORAGE TESTS
+
+TEST(EntityStoreTest, AddStopsAtCapacity) {
+    EntityStore store;
+    store.reserve(2);
+
+    EXPECT_EQ(store.add(SPRITE_CAN, 0, 0, 1, 10, 10), 0);
+    EXPECT_EQ(store.add(SPRITE_CUP, 0, 0, 1, 10, 10), 1);
+    EXPECT_TRUE(store.full());
+    EXPECT_EQ(store.add(SPRITE_BAG, 0, 0, 1, 10, 10), -1);
+    EXPECT_EQ(store.size(), 2);
+}
+
+TEST(EntityStoreTest, RemoveSwapsLastIntoGap) {
+    EntityStore store;
+    store.reserve(8);
+    store.add(SPRITE_CAN, 1, 0, 1, 10, 10);
+    store.add(SPRITE_CUP, 2, 0, 1, 10, 10);
+    store.add(SPRITE_BAG, 3, 0, 1, 10, 10);
+
+    store.remove(0);
+    ASSERT_EQ(store.size(), 2);
+    EXPECT_EQ(store.sprite[0], SPRITE_BAG);
+    EXPECT_FLOAT_EQ(store.x[0], 3.0f);
+    EXPECT_EQ(store.sprite[1], SPRITE_CUP);
+}
+
+TEST(EntityStoreTest, RemoveInactiveKeepsOnlyLive) {
+    EntityStore store;
+    store.reserve(8);
+    for (int i = 0; i < 6; i++) store.add(SPRITE_CAN, float(i), 0, 1, 10, 10);
+    store.flags[0] = 0;
+    store.flags[3] = 0;
+    store.flags[5] = 0;
+
+    store.removeInactive();
+    ASSERT_EQ(store.size(), 3);
+    for (int i = 0; i < store.size(); i++) {
+        EXPECT_TRUE(store.flags[i] & EntityStore::FLAG_ACTIVE);
+        EXPECT_TRUE(store.x[i] == 1.0f || store.x[i] == 2.0f || store.x[i] == 4.0f);
+    }
+}
+
+//  UPDATE PASS TESTS
+
+TEST(EntityStoreTest, DriftLeftMovesBySpeed) {
+    EntityStore store;
+    store.reserve(8);
+    store.add(SPRITE_CAN, 100, 100, 4, 10, 10);
+    store.add(SPRITE_BAG, 300, 200, 2.5f, 10, 10);
+
+    for (int frame = 0; frame < 2; frame++) store.driftLeft();
+
+    // 2 frames at each one's own speed, height untouched
+    EXPECT_FLOAT_EQ(store.x[0], 92.0f);
+    EXPECT_FLOAT_EQ(store.y[0], 100.0f);
+    EXPECT_FLOAT_EQ(store.x[1], 295.0f);
+    EXPECT_FLOAT_EQ(store.y[1], 200.0f);
+}
+
+TEST(EntityStoreTest, DeactivateLeftOfOnlyClearsActive) {
+    EntityStore store;
+    store.reserve(8);
+    store.add(SPRITE_CAN, 0, 0, 1, 20, 20);
+    store.add(SPRITE_CAN, 500, 500, 1, 20, 20);
+
+    store.deactivateLeftOf(100);
+    EXPECT_FALSE(store.flags[0] & EntityStore::FLAG_ACTIVE);
+    EXPECT_TRUE(store.flags[1] & EntityStore::FLAG_ACTIVE);
+}
+
+//  LEVEL 4 INTEGRATION
+
+TEST(EntityStoreTest, Level4CollectsFlowLitter) {
+    Level4 level{SimConfig()};
+
+    // Park the submarine where the flow enters so litter runs into it
+    Submarine sub(SPRITE_SUBMARINE, 700, 0, 100, 600);
+    std::vector<SimEvent> events;
+    int collected = 0;
+    for (int frame = 0; frame < 120; frame++) {
+        events.clear();
+        level.update(sub, events);
+        for (const SimEvent& e : events) {
+            if (e.type == SimEventType::LitterCollected) collected++;
+        }
+    }
+
+    EXPECT_GT(collected, 0);
+
+    // Whatever is left hasn't reached the submarine yet
+    const EntityStore& flow = level.getLitterFlow();
+    for (int i = 0; i < flow.size(); i++) {
+        EXPECT_GE(flow.x[i], 800.0f);
+    }
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "../include/TideSweeperEnv.h"
+
+TEST(EnvTest, ActionsCoverEveryMoveWithAndWithoutCalm) {
+    SimInput stay = TideSweeperEnv::actionToInput(0);
+    EXPECT_FALSE(stay.up || stay.down || stay.left || stay.right || stay.calm);
+
+    SimInput upRight = TideSweeperEnv::actionToInput(2);
+    EXPECT_TRUE(upRight.up && upRight.right);
+    EXPECT_FALSE(upRight.down || upRight.left || upRight.calm);
+
+    SimInput calmLeft = TideSweeperEnv::actionToInput(TideSweeperEnv::MOVE_COUNT + 7);
+    EXPECT_TRUE(calmLeft.left && calmLeft.calm);
+    EXPECT_FALSE(calmLeft.up || calmLeft.down || calmLeft.right);
+
+    // Never both directions on one axis
+    for (int a = 0; a < TideSweeperEnv::ACTION_COUNT; a++) {
+        SimInput in = TideSweeperEnv::actionToInput(a);
+        EXPECT_FALSE(in.up && in.down);
+        EXPECT_FALSE(in.left && in.right);
+        EXPECT_EQ(in.calm, a >= TideSweeperEnv::MOVE_COUNT);
+    }
+}
+
+TEST(EnvTest, ObservationSeesSubmarineAndLitter) {
+    TideSweeperEnv env;
+    env.reset(1);
+    std::vector<float> obs(TideSweeperEnv::OBS_SIZE);
+    env.observe(obs.data());
+
+    // Submarine starts at (200, 275), 112x112
+    EXPECT_FLOAT_EQ(obs[0], 256.0f / 800.0f);
+    EXPECT_FLOAT_EQ(obs[1], 331.0f / 600.0f);
+    EXPECT_FLOAT_EQ(obs[2], 1.0f);
+    EXPECT_FLOAT_EQ(obs[3], 0.0f);
+
+    // Level 1 has 7 litter items and no animals
+    const float* litter = obs.data() + 6;
+    for (int k = 0; k < 7; k++) EXPECT_EQ(litter[k * 3 + 2], 1.0f);
+    EXPECT_EQ(litter[7 * 3 + 2], 0.0f);
+    float first = litter[0] * litter[0] * 800 * 800 + litter[1] * litter[1] * 600 * 600;
+    float second = litter[3] * litter[3] * 800 * 800 + litter[4] * litter[4] * 600 * 600;
+    EXPECT_LE(first, second);
+
+    const float* enemies = litter + TideSweeperEnv::NEAREST_LITTER * 3;
+    for (int k = 0; k < TideSweeperEnv::NEAREST_ENEMIES; k++) EXPECT_EQ(enemies[k * 5 + 2], 0.0f);
+}
+
+TEST(EnvTest, MissedLitterCostsReward) {
+    TideSweeperEnv env;
+    env.reset(1);
+
+    // Parked in the top-left corner, litter drifts past
+    float total = 0.0f;
+    for (int i = 0; i < 600; i++) {
+        total += env.step(8).reward;
+    }
+    EXPECT_LT(total, 0.0f);
+    EXPECT_FLOAT_EQ(total, env.getSimulation().getScore() * TideSweeperEnv::REWARD_PER_POINT);
+}
+
+TEST(EnvTest, TruncatesAtMaxSteps) {
+    TideSweeperEnv env(SimConfig(), 50, 2);
+    env.reset(3);
+    TideSweeperEnv::StepResult result;
+    for (int i = 0; i < 50; i++) {
+        ASSERT_FALSE(env.isDone());
+        result = env.step(0);
+    }
+    EXPECT_TRUE(result.truncated);
+    EXPECT_FALSE(result.terminated);
+    EXPECT_TRUE(env.isDone());
+}
+
+TEST(EnvTest, VecEnvMatchesSingleEnvsAtAnyThreadCount) {
+    const int count = 6;
+    const int steps = 400;
+    VecEnv serial(count, SimConfig(), 1, 150);
+    VecEnv parallel(count, SimConfig(), 3, 150);
+    serial.reset(10);
+    parallel.reset(10);
+
+    // Reference: env 2 on its own, resetting the way VecEnv does
+    TideSweeperEnv single(SimConfig(), 150);
+    single.reset(12);
+    int singleEpisodes = 0;
+    std::vector<float> singleObs(TideSweeperEnv::OBS_SIZE);
+
+    std::vector<int> actions(count);
+    int dones = 0;
+    for (int t = 0; t < steps; t++) {
+        for (int i = 0; i < count; i++) actions[i] = (t / 7 + i * 5) % TideSweeperEnv::ACTION_COUNT;
+        serial.step(actions.data());
+        parallel.step(actions.data());
+
+        for (int i = 0; i < count * TideSweeperEnv::OBS_SIZE; i++) {
+            ASSERT_EQ(serial.getObservations()[i], parallel.getObservations()[i]) << "step " << t;
+        }
+        for (int i = 0; i < count; i++) {
+            ASSERT_EQ(serial.getRewards()[i], parallel.getRewards()[i]);
+            ASSERT_EQ(serial.getDones()[i], parallel.getDones()[i]);
+            dones += serial.getDones()[i];
+        }
+
+        TideSweeperEnv::StepResult r = single.step(actions[2]);
+        EXPECT_EQ(r.reward, serial.getRewards()[2]);
+        if (single.isDone()) single.reset(12 + uint64_t(count) * ++singleEpisodes);
+        single.observe(singleObs.data());
+        for (int i = 0; i < TideSweeperEnv::OBS_SIZE; i++) {
+            ASSERT_EQ(singleObs[i], serial.getObservations()[2 * TideSweeperEnv::OBS_SIZE + i]);
+        }
+    }
+
+    // 150-step episodes: everyone restarted at least twice
+    EXPECT_GE(dones, count * 2);
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "../include/JobPool.h"
+#include "../include/Simulation.h"
+#include "../include/Autopilot.h"
+
+TEST(JobPoolTest, EveryIndexRunsOnceInItsChunk) {
+    JobPool pool(4);
+    EXPECT_EQ(pool.getThreadCount(), 4);
+
+    const int count = 10007, grain = 7;
+    std::vector<std::atomic<int>> hits(count);
+    std::vector<int> chunkBegin(JobPool::chunkCount(count, grain), -1);
+    pool.parallelFor(count, grain, [&](int chunk, int begin, int end) {
+        chunkBegin[chunk] = begin;
+        EXPECT_EQ(begin, chunk * grain);
+        EXPECT_EQ(end, std::min(count, begin + grain));
+        for (int i = begin; i < end; i++) hits[i]++;
+    });
+
+    for (int i = 0; i < count; i++) ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+    for (int c = 0; c < (int)chunkBegin.size(); c++) EXPECT_EQ(chunkBegin[c], c * grain);
+
+    // Nothing to do is fine too
+    pool.parallelFor(0, grain, [&](int, int, int) { FAIL(); });
+}
+
+TEST(JobPoolTest, IdleThreadsStealFromBusyOnes) {
+    JobPool pool(4);
+
+    // Thread 1's share of the chunks is slow, everyone else's is instant
+    const int chunks = 32;
+    std::atomic<int> done(0);
+    pool.parallelFor(chunks, 1, [&](int chunk, int, int) {
+        if (chunk >= chunks / 4 && chunk < chunks / 2) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        done++;
+    });
+    EXPECT_EQ(done.load(), chunks);
+    EXPECT_GT(pool.getStealCount(), 0);
+}
+
+TEST(JobPoolTest, SingleThreadRunsOnCaller) {
+    JobPool pool(1);
+    std::thread::id caller = std::this_thread::get_id();
+    int chunksRun = 0;
+    pool.parallelFor(100, 10, [&](int chunk, int, int) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(chunk, chunksRun);  // In order
+        chunksRun++;
+    });
+    EXPECT_EQ(chunksRun, 10);
+}
+
+// Run a whole game with and without a pool (tiny chunks, so every pass
+// really gets split) and check they never drift apart
+TEST(JobPoolTest, PooledGameMatchesSerialGame) {
+    JobPool pool(4);
+    Simulation serial(SimConfig(), 42);
+    Simulation pooled(SimConfig(), 42);
+    pooled.setJobPool(&pool, 1);
+
+    int levelsSeen = 1;
+    for (int tick = 0; tick < 60 * 60 * 3 && !serial.isGameOver(); tick++) {
+        SimInput input = Autopilot::decide(serial);
+        serial.step(input);
+        pooled.step(input);
+
+        ASSERT_EQ(serial.getEvents().size(), pooled.getEvents().size()) << "tick " << tick;
+        for (size_t i = 0; i < serial.getEvents().size(); i++) {
+            ASSERT_EQ(serial.getEvents()[i].type, pooled.getEvents()[i].type) << "tick " << tick;
+            ASSERT_EQ(serial.getEvents()[i].value, pooled.getEvents()[i].value) << "tick " << tick;
+        }
+        ASSERT_EQ(serial.getScore(), pooled.getScore()) << "tick " << tick;
+        ASSERT_EQ(serial.getLives(), pooled.getLives()) << "tick " << tick;
+        ASSERT_EQ(serial.getLevel().getEnemyItems().size(), pooled.getLevel().getEnemyItems().size());
+        ASSERT_EQ(serial.getLevel().getLitterFlow().size(), pooled.getLevel().getLitterFlow().size());
+        levelsSeen = std::max(levelsSeen, serial.getLevelNumber());
+    }
+    EXPECT_GE(levelsSeen, 3);
+    EXPECT_EQ(serial.isVictory(), pooled.isVictory());
+}
+
+TEST(JobPoolTest, CrowdedLevelMatchesSerial) {
+    JobPool pool(3);
+    SimConfig config;
+    Level3 serial(config, 7);
+    Level3 pooled(config, 7);
+    pooled.setJobPool(&pool, 16);
+
+    // Lots of litter and animals, octopuses included so there's ink
+    std::vector<Litter> litter;
+    std::vector<Enemies> enemies;
+    for (int i = 0; i < 500; i++) {
+        litter.push_back(Litter(SPRITE_CAN + i % 7, float(i * 37 % 900), float(i * 53 % 550), 1.0f + i % 5, 37, 60));
+    }
+    for (int i = 0; i < 300; i++) {
+        int type = i % 5;
+        enemies.push_back(Enemies(SPRITE_SWORDFISH + type, float(i * 31 % 900), float(i * 47 % 650), 4.0f, 60, 40, type));
+    }
+    serial.setLitterItems(litter);
+    pooled.setLitterItems(litter);
+    serial.setEnemyItems(enemies);
+    pooled.setEnemyItems(enemies);
+
+    Submarine subA(SPRITE_SUBMARINE, 300, 250, 112, 112);
+    Submarine subB(SPRITE_SUBMARINE, 300, 250, 112, 112);
+    std::vector<SimEvent> eventsA, eventsB;
+    for (int tick = 0; tick < 150; tick++) {
+        serial.update(subA, eventsA);
+        pooled.update(subB, eventsB);
+    }
+
+    ASSERT_EQ(eventsA.size(), eventsB.size());
+    for (size_t i = 0; i < eventsA.size(); i++) {
+        EXPECT_EQ(eventsA[i].type, eventsB[i].type);
+    }
+    ASSERT_EQ(serial.getLitterItems().size(), pooled.getLitterItems().size());
+    for (size_t i = 0; i < serial.getLitterItems().size(); i++) {
+        EXPECT_EQ(serial.getLitterItems()[i].x, pooled.getLitterItems()[i].x);
+        EXPECT_EQ(serial.getLitterItems()[i].y, pooled.getLitterItems()[i].y);
+    }
+    ASSERT_EQ(serial.getEnemyItems().size(), pooled.getEnemyItems().size());
+    for (size_t i = 0; i < serial.getEnemyItems().size(); i++) {
+        EXPECT_EQ(serial.getEnemyItems()[i].x, pooled.getEnemyItems()[i].x);
+        EXPECT_EQ(serial.getEnemyItems()[i].y, pooled.getEnemyItems()[i].y);
+    }
+    ASSERT_EQ(serial.getOilSpots().size(), pooled.getOilSpots().size());
+    EXPECT_GT(serial.getOilSpots().size(), 0u);
+    for (size_t i = 0; i < serial.getOilSpots().size(); i++) {
+        EXPECT_EQ(serial.getOilSpots()[i].x, pooled.getOilSpots()[i].x);
+        EXPECT_EQ(serial.getOilSpots()[i].alpha, pooled.getOilSpots()[i].alpha);
+    }
+}
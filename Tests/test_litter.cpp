@@ -9,16 +9,16 @@ using ::testing::_;
 class LitterTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        texture = nullptr;
+        sprite = SPRITE_CAN;
     }
 
-    SDL_Texture* texture;
+    int sprite;
 };
 
 //  ASSERTION TESTS 
 
 TEST_F(LitterTest, LitterCreation) {
-    Litter litter(texture, 100.0f, 150.0f, 5.0f);
+    Litter litter(sprite, 100.0f, 150.0f, 5.0f);
     
     EXPECT_FLOAT_EQ(litter.x, 100.0f);
     EXPECT_FLOAT_EQ(litter.y, 150.0f);
@@ -27,17 +27,18 @@ TEST_F(LitterTest, LitterCreation) {
 }
 
 TEST_F(LitterTest, LitterMovement) {
-    Litter litter(texture, 100.0f, 150.0f, 5.0f);
+    Litter litter(sprite, 100.0f, 150.0f, 5.0f);
     
     float initialX = litter.x;
-    litter.update();
+    Rng rng;
+    litter.update(rng);
     
     // Litter should move left (decrease X)
     EXPECT_LT(litter.x, initialX);
 }
 
 TEST_F(LitterTest, LitterCollection) {
-    Litter litter(texture, 100.0f, 150.0f, 5.0f);
+    Litter litter(sprite, 100.0f, 150.0f, 5.0f);
     
     EXPECT_TRUE(litter.active);
     EXPECT_EQ(litter.respawnTimer, 0);
@@ -49,7 +50,7 @@ TEST_F(LitterTest, LitterCollection) {
 }
 
 TEST_F(LitterTest, RespawnTimer) {
-    Litter litter(texture, 100.0f, 150.0f, 5.0f);
+    Litter litter(sprite, 100.0f, 150.0f, 5.0f);
     
     litter.collect();
     int initialTimer = litter.respawnTimer;
@@ -57,28 +58,29 @@ TEST_F(LitterTest, RespawnTimer) {
     EXPECT_GT(initialTimer, 0);
     
     // Update should decrement respawn timer when inactive
-    litter.update();
+    Rng rng;
+    litter.update(rng);
     EXPECT_LT(litter.respawnTimer, initialTimer);
 }
 
 TEST_F(LitterTest, CollisionDetection) {
-    Litter litter(texture, 100.0f, 100.0f, 5.0f);
+    Litter litter(sprite, 100.0f, 100.0f, 5.0f);
     litter.active = true;
     
     // Overlapping submarine
-    SDL_Rect subRect = {90, 90, 64, 64};
+    SimRect subRect = {90, 90, 64, 64};
     EXPECT_TRUE(litter.checkCollision(subRect));
     
     // Non-overlapping submarine
-    SDL_Rect farSubRect = {500, 500, 64, 64};
+    SimRect farSubRect = {500, 500, 64, 64};
     EXPECT_FALSE(litter.checkCollision(farSubRect));
 }
 
 TEST_F(LitterTest, NoCollisionWhenInactive) {
-    Litter litter(texture, 100.0f, 100.0f, 5.0f);
+    Litter litter(sprite, 100.0f, 100.0f, 5.0f);
     litter.active = false;
     
-    SDL_Rect subRect = {90, 90, 64, 64};
+    SimRect subRect = {90, 90, 64, 64};
     EXPECT_FALSE(litter.checkCollision(subRect));
 }
 
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "../include/Profiler.h"
+
+namespace {
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+}
+
+TEST(ProfilerTest, RingKeepsNewestZones) {
+    Profiler::clear();
+    for (int i = 0; i < Profiler::RING_SIZE + 100; i++) {
+        Profiler::Zone zone("Spin");
+    }
+    EXPECT_EQ(Profiler::threadZoneCount(), Profiler::RING_SIZE);
+
+    Profiler::clear();
+    EXPECT_EQ(Profiler::threadZoneCount(), 0);
+}
+
+TEST(ProfilerTest, WritesChromeTrace) {
+    Profiler::clear();
+    Profiler::setThreadName("Test \"main\"");
+    {
+        Profiler::Zone outer("Outer");
+        Profiler::Zone inner("Inner");
+    }
+
+    // Zones from other threads land in their own buffer
+    std::thread worker([] {
+        Profiler::setThreadName("Worker");
+        Profiler::Zone zone("WorkerZone");
+    });
+    worker.join();
+
+    const std::string path = "profiler_test_trace.json";
+    ASSERT_TRUE(Profiler::writeChromeTrace(path));
+    std::string json = readFile(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(json.find("{\"traceEvents\":["), 0u);
+    EXPECT_NE(json.find("\"name\":\"Outer\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Inner\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"WorkerZone\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"name\":\"Worker\"}"), std::string::npos);
+    EXPECT_NE(json.find("Test \\\"main\\\""), std::string::npos);  // Escaped
+}
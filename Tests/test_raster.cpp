@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "../include/StateRaster.h"
+
+TEST(StateRasterTest, DrawsEntitiesIntoTheirChannels) {
+    SimConfig config;
+    Level2 level(config);
+    level.setLitterItems({ Litter(SPRITE_CAN, 200.0f, 300.0f, 1.5f, 37, 60) });
+    level.setEnemyItems({ Enemies(SPRITE_SHARK, 500.0f, 100.0f, 4.0f, 60, 40, 4) });
+    Submarine sub(SPRITE_SUBMARINE, 50, 0, 112, 112);
+
+    StateRaster raster;
+    raster.rasterize(level, sub);
+
+    // Litter covers x 200-236, y 300-359: cells 20-23, 30-35
+    EXPECT_EQ(raster.at(StateRaster::CH_LITTER, 20, 30), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_LITTER, 23, 35), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_LITTER, 24, 30), 0);
+    EXPECT_EQ(raster.at(StateRaster::CH_LITTER, 20, 36), 0);
+    EXPECT_EQ(raster.at(StateRaster::CH_LITTER, 19, 29), 0);
+
+    EXPECT_EQ(raster.at(StateRaster::CH_SHARK, 50, 10), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_SHARK, 55, 13), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_SWORDFISH, 50, 10), 0);
+
+    EXPECT_EQ(raster.at(StateRaster::CH_SUBMARINE, 5, 0), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_SUBMARINE, 16, 11), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_SUBMARINE, 17, 11), 0);
+
+    int litterCells = 0;
+    for (int i = 0; i < StateRaster::PLANE_SIZE; i++) {
+        litterCells += raster.plane(StateRaster::CH_LITTER)[i] != 0;
+    }
+    EXPECT_EQ(litterCells, 4 * 6);
+}
+
+TEST(StateRasterTest, ClipsAtScreenEdges) {
+    SimConfig config;
+    Level1 level(config);
+    level.setLitterItems({ Litter(SPRITE_CAN, -15.0f, 590.0f, 1.5f, 37, 60),
+                           Litter(SPRITE_CAN, 850.0f, 300.0f, 1.5f, 37, 60) });
+    Submarine sub(SPRITE_SUBMARINE, 790, -20, 112, 112);
+
+    StateRaster raster;
+    raster.rasterize(level, sub);
+
+    // x -15..21 -> cells 0-2, y 590.. -> last row only
+    EXPECT_EQ(raster.at(StateRaster::CH_LITTER, 0, 59), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_LITTER, 2, 59), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_LITTER, 3, 59), 0);
+    EXPECT_EQ(raster.at(StateRaster::CH_SUBMARINE, 79, 0), 255);
+    EXPECT_EQ(raster.at(StateRaster::CH_SUBMARINE, 78, 0), 0);
+
+    int litterCells = 0;
+    for (int i = 0; i < StateRaster::PLANE_SIZE; i++) {
+        litterCells += raster.plane(StateRaster::CH_LITTER)[i] != 0;
+    }
+    EXPECT_EQ(litterCells, 3);
+}
+
+TEST(StateRasterTest, BlackoutMatchesLevelAtCellCenters) {
+    SimConfig config;
+    Level3 level(config);
+    Submarine sub(SPRITE_SUBMARINE, -500, -500, 1, 1);
+    std::vector<SimEvent> events;
+    StateRaster raster;
+
+    int blackoutFrames = 0;
+    for (int frame = 0; frame < 1500; frame++) {
+        level.update(sub, events);
+        raster.rasterize(level, sub);
+        if (level.isInBlackout() || level.isBlackoutFadingOut()) blackoutFrames++;
+
+        for (int gy = 0; gy < StateRaster::HEIGHT; gy++) {
+            for (int gx = 0; gx < StateRaster::WIDTH; gx++) {
+                int x = gx * StateRaster::CELL + StateRaster::CELL / 2;
+                int y = gy * StateRaster::CELL + StateRaster::CELL / 2;
+                bool expected = level.isPositionInBlackout(x, y);
+                ASSERT_EQ(raster.at(StateRaster::CH_BLACKOUT, gx, gy) != 0, expected)
+                    << "frame " << frame << " cell " << gx << "," << gy;
+            }
+        }
+    }
+    EXPECT_GT(blackoutFrames, 0);
+}
@@ -5,6 +5,18 @@
 #include "../include/Submarine.h"
 #include "../include/Litter.h"
 #include "../include/ScoreDisplay.hpp"
+#include "../include/LevelRenderer.h"
+#include "../include/Level.h"
+#include "../include/TextRenderer.h"
+#include "../include/FontManager.h"
+#include "../include/SpriteAtlas.h"
+#include "../include/AssetLoader.h"
+#include "../include/AssetCache.h"
+#include "../include/RenderStats.h"
+#include "../include/PerfHud.h"
+#include "../include/RenderList.h"
+#include "../include/FramePipeline.h"
+#include <thread>
 
 // Test fixture that initializes SDL for rendering tests
 class RenderingTest : public ::testing::Test {
@@ -20,8 +32,8 @@ protected:
         int imgFlags = IMG_INIT_PNG;
         ASSERT_TRUE(IMG_Init(imgFlags) & imgFlags) << "SDL_image init failed: " << IMG_GetError();
         
-        // Initialize SDL_ttf
-        ASSERT_EQ(TTF_Init(), 0) << "SDL_ttf init failed: " << TTF_GetError();
+        // Initialize SDL_ttf (through the font registry, ScoreDisplay uses it)
+        ASSERT_TRUE(FontManager::init()) << "SDL_ttf init failed: " << TTF_GetError();
         
         // Create a window (hidden for testing)
         window = SDL_CreateWindow(
@@ -39,12 +51,21 @@ protected:
     }
     
     void TearDown() override {
+        FontManager::releaseAtlases();  // Glyph atlases belong to this renderer
         if (renderer) SDL_DestroyRenderer(renderer);
         if (window) SDL_DestroyWindow(window);
-        TTF_Quit();
+        FontManager::shutdown();
         IMG_Quit();
         SDL_Quit();
     }
+
+    // Atlas with every sprite ID packed from the same surface
+    void buildAtlas(SpriteAtlas& atlas, SDL_Surface* surface) {
+        for (int i = 0; i < SPRITE_COUNT; i++) {
+            atlas.add(i, surface, 64, 64, true);
+        }
+        ASSERT_TRUE(atlas.build());
+    }
 };
 
 TEST_F(RenderingTest, RendererInitialization) {
@@ -59,40 +80,40 @@ TEST_F(RenderingTest, RendererInitialization) {
 }
 
 TEST_F(RenderingTest, SubmarineRendering) {
-    // Create a simple texture for testing (1x1 pixel)
+    // Create a simple sprite atlas for testing (1x1 pixel image)
     SDL_Surface* surface = SDL_CreateRGBSurface(0, 1, 1, 32, 0, 0, 0, 0);
     ASSERT_NE(surface, nullptr);
     
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SpriteAtlas atlas(renderer);
+    buildAtlas(atlas, surface);
     SDL_FreeSurface(surface);
-    ASSERT_NE(texture, nullptr);
     
     // Create submarine
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(SPRITE_SUBMARINE, 100, 200, 64, 64);
+    LevelRenderer levelRenderer(renderer, atlas);
     
     // Test that rendering doesn't crash
-    EXPECT_NO_THROW(sub.render(renderer));
-    
-    SDL_DestroyTexture(texture);
+    EXPECT_NO_THROW(levelRenderer.renderSubmarine(sub));
 }
 
 TEST_F(RenderingTest, LitterRendering) {
-    // Create a simple texture for testing
+    // Create a simple sprite atlas for testing
     SDL_Surface* surface = SDL_CreateRGBSurface(0, 1, 1, 32, 0, 0, 0, 0);
     ASSERT_NE(surface, nullptr);
     
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SpriteAtlas atlas(renderer);
+    buildAtlas(atlas, surface);
     SDL_FreeSurface(surface);
-    ASSERT_NE(texture, nullptr);
     
-    // Create litter
-    Litter litter(texture, 300.0f, 200.0f, 5.0f);
+    // Create a level holding one litter item
+    Level1 level{SimConfig()};
+    Litter litter(SPRITE_CAN, 300.0f, 200.0f, 5.0f);
     litter.active = true;
+    level.setLitterItems({ litter });
+    LevelRenderer levelRenderer(renderer, atlas);
     
     // Test that rendering doesn't crash
-    EXPECT_NO_THROW(litter.render(renderer));
-    
-    SDL_DestroyTexture(texture);
+    EXPECT_NO_THROW(levelRenderer.render(level));
 }
 
 TEST_F(RenderingTest, ScoreDisplayRendering) {
@@ -144,20 +165,23 @@ TEST_F(RenderingTest, TextureCreation) {
 }
 
 TEST_F(RenderingTest, MultipleObjectsRendering) {
-    // Create textures
+    // Create the sprite atlas
     SDL_Surface* surface = SDL_CreateRGBSurface(0, 32, 32, 32, 0, 0, 0, 0);
     ASSERT_NE(surface, nullptr);
     
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SpriteAtlas atlas(renderer);
+    buildAtlas(atlas, surface);
     SDL_FreeSurface(surface);
-    ASSERT_NE(texture, nullptr);
     
     // Create multiple objects
-    Submarine sub(texture, 50, 300, 64, 64);
-    Litter litter1(texture, 200.0f, 150.0f, 5.0f);
-    Litter litter2(texture, 400.0f, 250.0f, 5.0f);
+    Submarine sub(SPRITE_SUBMARINE, 50, 300, 64, 64);
+    Litter litter1(SPRITE_CAN, 200.0f, 150.0f, 5.0f);
+    Litter litter2(SPRITE_BOTTLE, 400.0f, 250.0f, 5.0f);
     litter1.active = true;
     litter2.active = true;
+    Level1 level{SimConfig()};
+    level.setLitterItems({ litter1, litter2 });
+    LevelRenderer levelRenderer(renderer, atlas);
     
     // Clear screen
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
@@ -165,13 +189,11 @@ TEST_F(RenderingTest, MultipleObjectsRendering) {
     
     // Render all objects - should not crash
     EXPECT_NO_THROW({
-        sub.render(renderer);
-        litter1.render(renderer);
-        litter2.render(renderer);
+        levelRenderer.render(level);
+        levelRenderer.renderSubmarine(sub);
+        levelRenderer.renderHearts(3);
         SDL_RenderPresent(renderer);
     });
-    
-    SDL_DestroyTexture(texture);
 }
 
 TEST_F(RenderingTest, RenderWithBlendMode) {
@@ -190,3 +212,324 @@ TEST_F(RenderingTest, RenderWithBlendMode) {
     
     SDL_DestroyTexture(texture);
 }
+
+
+TEST_F(RenderingTest, TextRendererWrapsToWidth) {
+    TTF_Font* font = FontManager::get(UI_FONT_PATH, 20);
+    if (!font) GTEST_SKIP() << "OpenSans.ttf not found next to the test binary";
+
+    TextRenderer text(renderer, font);
+    ASSERT_TRUE(text.isLoaded());
+
+    const std::string msg = "Swim close to litter to collect it and keep the ocean clean!";
+
+    int lineW = 0, lineH = 0;
+    text.measure(msg, &lineW, &lineH);
+    EXPECT_GT(lineW, 200);
+    EXPECT_EQ(lineH, TTF_FontHeight(font));
+
+    // Wrapping keeps every line inside the box
+    int wrapW = 0, wrapH = 0;
+    text.measureWrapped(msg, 200, &wrapW, &wrapH);
+    EXPECT_LE(wrapW, 200);
+    EXPECT_GT(wrapH, lineH);
+
+    // Explicit newlines always break
+    int nlW = 0, nlH = 0;
+    text.measureWrapped("one\ntwo", 0, &nlW, &nlH);
+    EXPECT_EQ(nlH, text.getLineHeight() + lineH);
+
+    EXPECT_NO_THROW({
+        text.draw(msg, 10, 10, SDL_Color{255, 255, 255, 255});
+        text.drawWrapped(msg, 10, 50, SDL_Color{255, 255, 255, 255}, 200);
+        SDL_RenderPresent(renderer);
+    });
+}
+
+TEST_F(RenderingTest, FontManagerSharesFonts) {
+    TTF_Font* a = FontManager::get(UI_FONT_PATH, 20);
+    if (!a) GTEST_SKIP() << "OpenSans.ttf not found next to the test binary";
+
+    // Same path and size gives back the same handle, other sizes don't
+    EXPECT_EQ(FontManager::get(UI_FONT_PATH, 20), a);
+    EXPECT_NE(FontManager::get(UI_FONT_PATH, 24), a);
+}
+
+TEST_F(RenderingTest, TextRenderersShareOneAtlasPerFont) {
+    TTF_Font* font = FontManager::get(UI_FONT_PATH, 20);
+    if (!font) GTEST_SKIP() << "OpenSans.ttf not found next to the test binary";
+
+    int atlasesBefore = FontManager::getAtlasCount();
+    int texturesBefore = RenderStats::getTextureCount();
+
+    // Three renderers on one font build (and upload) one atlas
+    TextRenderer first(renderer, font);
+    TextRenderer second(renderer, font);
+    TextRenderer* third = new TextRenderer(renderer, font);
+    ASSERT_TRUE(first.isLoaded());
+    EXPECT_EQ(FontManager::getAtlas(renderer, font), FontManager::getAtlas(renderer, font));
+    EXPECT_EQ(FontManager::getAtlasCount(), atlasesBefore + 1);
+    EXPECT_EQ(RenderStats::getTextureCount(), texturesBefore + 1);
+
+    // Deleting one leaves the atlas for the others
+    delete third;
+    EXPECT_TRUE(second.isLoaded());
+    int w = 0, h = 0;
+    second.measure("Tide", &w, &h);
+    EXPECT_GT(w, 0);
+
+    // Another size is another font, so it gets its own
+    TextRenderer bigger(renderer, FontManager::get(UI_FONT_PATH, 30));
+    EXPECT_EQ(FontManager::getAtlasCount(), atlasesBefore + 2);
+
+    FontManager::releaseAtlases();
+    EXPECT_EQ(FontManager::getAtlasCount(), 0);
+    EXPECT_EQ(RenderStats::getTextureCount(), texturesBefore);
+}
+
+TEST_F(RenderingTest, SpriteAtlasPacksVariants) {
+    SDL_Surface* surface = SDL_CreateRGBSurface(0, 16, 16, 32, 0, 0, 0, 0);
+    ASSERT_NE(surface, nullptr);
+
+    SpriteAtlas atlas(renderer);
+    atlas.add(SPRITE_CAN, surface, 30, 40, false);
+    atlas.add(SPRITE_SHARK, surface, 60, 40, true);
+    SDL_FreeSurface(surface);
+    ASSERT_TRUE(atlas.build());
+    EXPECT_NE(atlas.getTexture(), nullptr);
+
+    // Regions are packed at the requested size
+    const SDL_Rect* can = atlas.getRegion(SPRITE_CAN);
+    ASSERT_NE(can, nullptr);
+    EXPECT_EQ(can->w, 30);
+    EXPECT_EQ(can->h, 40);
+
+    // Sprites without variants fall back to the plain image
+    EXPECT_EQ(atlas.getRegion(SPRITE_CAN, SpriteAtlas::TINTED), can);
+
+    // Each shark variant gets its own spot, none overlapping
+    std::vector<SDL_Rect> used = { *can };
+    for (int v = 0; v < SpriteAtlas::VARIANT_COUNT; v++) {
+        const SDL_Rect* r = atlas.getRegion(SPRITE_SHARK, SpriteAtlas::Variant(v));
+        ASSERT_NE(r, nullptr);
+        EXPECT_EQ(r->w, 60);
+        for (const SDL_Rect& other : used) {
+            EXPECT_FALSE(SDL_HasIntersection(r, &other));
+        }
+        used.push_back(*r);
+    }
+
+    // Never added
+    EXPECT_EQ(atlas.getRegion(SPRITE_OIL), nullptr);
+}
+
+TEST_F(RenderingTest, AssetLoaderDecodesInBackground) {
+    const std::string path = "Assets/backgrounds/Level1.png";
+    SDL_Surface* probe = IMG_Load(path.c_str());
+    if (!probe) GTEST_SKIP() << "Level1.png not found next to the test binary";
+    SDL_FreeSurface(probe);
+
+    AssetLoader loader;
+    loader.request(path);
+    loader.request(path);  // Asking twice is fine
+
+    // Waits for the worker if it isn't done yet
+    SDL_Texture* texture = loader.takeTexture(renderer, path);
+    ASSERT_NE(texture, nullptr);
+    int w = 0, h = 0;
+    SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
+    EXPECT_GT(w, 0);
+    EXPECT_GT(h, 0);
+    RenderStats::destroyTexture(texture);
+
+    // Never requested: loaded on the spot
+    texture = loader.takeTexture(renderer, path);
+    EXPECT_NE(texture, nullptr);
+    RenderStats::destroyTexture(texture);
+
+    // Missing files come back as nullptr
+    loader.request("Assets/backgrounds/does_not_exist.png");
+    EXPECT_EQ(loader.takeTexture(renderer, "Assets/backgrounds/does_not_exist.png"), nullptr);
+}
+
+TEST_F(RenderingTest, AssetCacheLoadsEachFileOnce) {
+    const std::string path = "Assets/backgrounds/Level1.png";
+    SDL_Surface* probe = IMG_Load(path.c_str());
+    if (!probe) GTEST_SKIP() << "Level1.png not found next to the test binary";
+    SDL_FreeSurface(probe);
+
+    int loadsBefore = AssetCache::getLoadCount();
+    SDL_Texture* first = AssetCache::acquireTexture(renderer, path);
+    SDL_Texture* second = AssetCache::acquireTexture(renderer, path);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(AssetCache::getRefCount(path), 2);
+    EXPECT_EQ(AssetCache::getLoadCount(), loadsBefore + 1);
+
+    // Nobody holds it any more, but it's still there for the next screen
+    AssetCache::release(first);
+    AssetCache::release(second);
+    EXPECT_EQ(AssetCache::getRefCount(path), 0);
+    EXPECT_TRUE(AssetCache::hasTexture(path));
+    EXPECT_EQ(AssetCache::acquireTexture(renderer, path), first);
+    EXPECT_EQ(AssetCache::getLoadCount(), loadsBefore + 1);
+
+    // Held assets survive a purge, unused ones don't
+    SDL_Surface* image = AssetCache::acquireImage(path);
+    ASSERT_NE(image, nullptr);
+    AssetCache::release(image);
+    loadsBefore = AssetCache::getLoadCount();
+    AssetCache::purgeUnused();
+    EXPECT_TRUE(AssetCache::hasTexture(path));
+    EXPECT_EQ(AssetCache::getRefCount(path), 1);
+    image = AssetCache::acquireImage(path);  // Decoded again
+    EXPECT_NE(image, nullptr);
+    EXPECT_EQ(AssetCache::getLoadCount(), loadsBefore + 1);
+
+    AssetCache::shutdown();
+    EXPECT_FALSE(AssetCache::hasTexture(path));
+
+    // Missing files fail once and stay failed
+    loadsBefore = AssetCache::getLoadCount();
+    EXPECT_EQ(AssetCache::acquireTexture(renderer, "Assets/backgrounds/does_not_exist.png"), nullptr);
+    EXPECT_EQ(AssetCache::acquireTexture(renderer, "Assets/backgrounds/does_not_exist.png"), nullptr);
+    EXPECT_EQ(AssetCache::getLoadCount(), loadsBefore + 1);
+    AssetCache::shutdown();
+}
+
+TEST_F(RenderingTest, RenderStatsCountsCallsAndTextures) {
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, 32, 16, 32, SDL_PIXELFORMAT_RGBA32);
+    ASSERT_NE(surface, nullptr);
+
+    long long bytesBefore = RenderStats::getTextureBytes();
+    int countBefore = RenderStats::getTextureCount();
+    SDL_Texture* texture = RenderStats::createTexture(renderer, surface);
+    SDL_FreeSurface(surface);
+    ASSERT_NE(texture, nullptr);
+    EXPECT_EQ(RenderStats::getTextureCount(), countBefore + 1);
+    EXPECT_EQ(RenderStats::getTextureBytes(), bytesBefore + 32 * 16 * 4);
+
+    RenderStats::beginFrame();
+    SDL_Rect rect = { 0, 0, 10, 10 };
+    RenderStats::copy(renderer, texture, nullptr, &rect);
+    RenderStats::fillRect(renderer, &rect);
+    RenderStats::fillRect(renderer, &rect);
+    RenderStats::drawLine(renderer, 0, 0, 5, 5);
+    EXPECT_EQ(RenderStats::currentFrame().total(), 4);
+
+    // Next frame starts from zero, the finished one is kept for the HUD
+    RenderStats::beginFrame();
+    EXPECT_EQ(RenderStats::currentFrame().total(), 0);
+    EXPECT_EQ(RenderStats::lastFrame().copies, 1);
+    EXPECT_EQ(RenderStats::lastFrame().fills, 2);
+    EXPECT_EQ(RenderStats::lastFrame().outlines, 1);
+
+    RenderStats::destroyTexture(texture);
+    EXPECT_EQ(RenderStats::getTextureCount(), countBefore);
+    EXPECT_EQ(RenderStats::getTextureBytes(), bytesBefore);
+}
+
+TEST_F(RenderingTest, PerfHudFrameTimePercentiles) {
+    PerfHud hud(renderer);
+    EXPECT_FALSE(hud.isVisible());
+
+    // 99 smooth frames and one hitch
+    for (int i = 0; i < 99; i++) hud.recordFrame(16.0, 1.0, 2.0);
+    hud.recordFrame(50.0, 1.0, 2.0);
+    EXPECT_DOUBLE_EQ(hud.frameTimePercentile(50), 16.0);
+    EXPECT_DOUBLE_EQ(hud.frameTimePercentile(99), 16.0);
+    EXPECT_DOUBLE_EQ(hud.frameTimePercentile(100), 50.0);
+
+    // Only the last HISTORY frames count
+    for (int i = 0; i < PerfHud::HISTORY; i++) hud.recordFrame(20.0, 1.0, 2.0);
+    EXPECT_DOUBLE_EQ(hud.frameTimePercentile(100), 20.0);
+
+    // Drawing with nothing recorded or while hidden is harmless
+    Level1 level{SimConfig()};
+    hud.render(level);
+    hud.toggle();
+    hud.render(level);
+    EXPECT_TRUE(hud.isVisible());
+}
+
+// Color of one pixel of the current render target
+static Uint32 readPixel(SDL_Renderer* renderer, int x, int y) {
+    Uint32 pixel = 0;
+    SDL_Rect rect = { x, y, 1, 1 };
+    SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_RGBA32, &pixel, 4);
+    return pixel;
+}
+
+TEST_F(RenderingTest, RenderListRecordsAndReplays) {
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    Uint32 black = readPixel(renderer, 20, 20);
+
+    RenderList list;
+    RenderStats::beginFrame();
+    RenderStats::record(&list);
+    SDL_Rect rect = { 10, 10, 30, 30 };
+    RenderStats::setDrawColor(renderer, 255, 0, 0, 255);
+    RenderStats::fillRect(renderer, &rect);
+    SDL_Vertex quad[4] = {
+        { { 50, 10 }, { 0, 255, 0, 255 }, { 0, 0 } },
+        { { 80, 10 }, { 0, 255, 0, 255 }, { 0, 0 } },
+        { { 80, 40 }, { 0, 255, 0, 255 }, { 0, 0 } },
+        { { 50, 40 }, { 0, 255, 0, 255 }, { 0, 0 } },
+    };
+    int indices[6] = { 0, 1, 2, 0, 2, 3 };
+    RenderStats::geometry(renderer, nullptr, quad, 4, indices, 6);
+    RenderStats::record(nullptr);
+
+    // Counted, but nothing reached the renderer yet
+    EXPECT_EQ(RenderStats::currentFrame().fills, 1);
+    EXPECT_EQ(RenderStats::currentFrame().geometry, 1);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(readPixel(renderer, 20, 20), black);
+
+    // Same pixels as drawing directly
+    SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
+    SDL_RenderFillRect(renderer, &rect);
+    Uint32 red = readPixel(renderer, 20, 20);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+
+    // The list keeps its own copy of the vertices
+    quad[0].position.x = 500;
+    list.replay(renderer);
+    EXPECT_EQ(readPixel(renderer, 20, 20), red);
+    EXPECT_NE(readPixel(renderer, 65, 25), black);
+    EXPECT_EQ(readPixel(renderer, 95, 25), black);
+
+    list.reset();
+    EXPECT_TRUE(list.empty());
+}
+
+TEST_F(RenderingTest, FramePipelineBuildsOnAWorker) {
+    FramePipeline pipeline;
+    std::thread::id builtOn;
+    int frame = 0;
+    SDL_Rect rect = { 0, 0, 10, 10 };
+    std::function<void()> build = [&]() {
+        builtOn = std::this_thread::get_id();
+        frame++;
+        for (int i = 0; i < frame; i++) RenderStats::fillRect(renderer, &rect);
+    };
+
+    // First frame: nothing to draw yet, the built one waits for the next call
+    pipeline.runFrame(renderer, build);
+    EXPECT_NE(builtOn, std::this_thread::get_id());
+    EXPECT_EQ(pipeline.getPendingFrame().size(), 1);
+
+    pipeline.runFrame(renderer, build);
+    EXPECT_EQ(pipeline.getPendingFrame().size(), 2);
+
+    // Recording stops with the frame: this goes straight to SDL
+    EXPECT_EQ(RenderStats::fillRect(renderer, &rect), 0);
+    EXPECT_EQ(pipeline.getPendingFrame().size(), 2);
+
+    pipeline.discard();
+    EXPECT_TRUE(pipeline.getPendingFrame().empty());
+    pipeline.runFrame(renderer, build);
+    EXPECT_EQ(frame, 3);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <random>
+#include "../include/InputRecording.h"
+#include "../include/Simulation.h"
+
+namespace {
+
+// What a player would see after each tick
+struct Snapshot {
+    int score, lives, level;
+    SimRect sub;
+    int litter, enemies;
+};
+
+Snapshot snapshot(const Simulation& sim) {
+    return { sim.getScore(), sim.getLives(), sim.getLevelNumber(), sim.getSubmarine().getRect(),
+             int(sim.getLevel().getLitterItems().size()) + sim.getLevel().getLitterFlow().size(),
+             int(sim.getLevel().getEnemyItems().size()) };
+}
+
+}
+
+//  FILE FORMAT
+
+TEST(ReplayTest, RoundTripsThroughFile) {
+    InputRecording rec(12345);
+    SimInput up;
+    up.up = true;
+    SimInput calmLeft;
+    calmLeft.left = true;
+    calmLeft.calm = true;
+
+    for (int i = 0; i < 300; i++) rec.addTick(up);   // One run, long count
+    rec.addScreen(InputRecording::SCREEN_PAUSE, InputRecording::CHOICE_RESUME);
+    rec.addTick(calmLeft);
+    rec.addTick(SimInput());
+    rec.addScreen(InputRecording::SCREEN_GAME_OVER, InputRecording::CHOICE_RESTART);
+
+    const std::string path = "replay_test.tsr";
+    ASSERT_TRUE(rec.save(path));
+
+    InputRecording loaded;
+    ASSERT_TRUE(loaded.load(path));
+    std::remove(path.c_str());
+
+    EXPECT_EQ(loaded.getSeed(), 12345u);
+    EXPECT_EQ(loaded.getTickCount(), 302);
+
+    for (int i = 0; i < 300; i++) {
+        ASSERT_TRUE(loaded.nextIsTick());
+        EXPECT_TRUE(loaded.takeTick().up);
+    }
+
+    // Screens only come out when asked for by name
+    InputRecording::Choice choice;
+    EXPECT_FALSE(loaded.nextIsTick());
+    EXPECT_FALSE(loaded.takeScreen(InputRecording::SCREEN_GAME_OVER, choice));
+    ASSERT_TRUE(loaded.takeScreen(InputRecording::SCREEN_PAUSE, choice));
+    EXPECT_EQ(choice, InputRecording::CHOICE_RESUME);
+
+    SimInput in = loaded.takeTick();
+    EXPECT_TRUE(in.left && in.calm && !in.up);
+    in = loaded.takeTick();
+    EXPECT_FALSE(in.left || in.calm);
+
+    ASSERT_TRUE(loaded.takeScreen(InputRecording::SCREEN_GAME_OVER, choice));
+    EXPECT_EQ(choice, InputRecording::CHOICE_RESTART);
+    EXPECT_TRUE(loaded.atEnd());
+}
+
+TEST(ReplayTest, RejectsOtherFiles) {
+    const std::string path = "replay_test_bad.tsr";
+    FILE* f = fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    fputs("not a replay", f);
+    fclose(f);
+
+    InputRecording rec;
+    EXPECT_FALSE(rec.load(path));
+    std::remove(path.c_str());
+    EXPECT_FALSE(rec.load("does_not_exist.tsr"));
+}
+
+TEST(ReplayTest, EachGameRecordsToItsOwnFile) {
+    EXPECT_EQ(InputRecording::pathForGame("run.tsr", 1), "run.tsr");
+    EXPECT_EQ(InputRecording::pathForGame("run.tsr", 2), "run-2.tsr");
+    EXPECT_EQ(InputRecording::pathForGame("runs/run", 3), "runs/run-3");
+    EXPECT_EQ(InputRecording::pathForGame("v1.0/run", 2), "v1.0/run-2");
+    EXPECT_EQ(InputRecording::pathForGame(".rec", 2), ".rec-2");
+
+    // Three trips through the menu, the way main.cpp records them
+    const std::string path = "replay_test_multi.tsr";
+    SimInput up;
+    up.up = true;
+    for (int game = 1; game <= 3; game++) {
+        InputRecording rec(1000u + game);
+        for (int i = 0; i < game * 10; i++) rec.addTick(up);
+        rec.addScreen(InputRecording::SCREEN_GAME_OVER, InputRecording::CHOICE_MENU);
+        ASSERT_TRUE(rec.save(InputRecording::pathForGame(path, game)));
+    }
+
+    // Later games didn't overwrite earlier ones
+    for (int game = 1; game <= 3; game++) {
+        const std::string gamePath = InputRecording::pathForGame(path, game);
+        InputRecording loaded;
+        ASSERT_TRUE(loaded.load(gamePath));
+        std::remove(gamePath.c_str());
+
+        EXPECT_EQ(loaded.getSeed(), 1000u + game);
+        EXPECT_EQ(loaded.getTickCount(), game * 10);
+    }
+}
+
+//  DETERMINISM
+
+TEST(ReplayTest, SameSeedAndInputsReproduceSession) {
+    const uint32_t seed = 2024;
+    const int ticks = 6000;   // Long enough for enemies, misses and hits
+
+    // Play with random inputs
+    Simulation original(SimConfig(), seed);
+    InputRecording rec(seed);
+    std::mt19937 player(7);
+    std::vector<Snapshot> expected;
+    SimInput input;
+    for (int t = 0; t < ticks; t++) {
+        if (t % 20 == 0) input = InputRecording::unpackInput(uint8_t(player() & 31));
+        if (original.isGameOver()) {
+            rec.addScreen(InputRecording::SCREEN_GAME_OVER, InputRecording::CHOICE_RESTART);
+            original.reset();
+        }
+        rec.addTick(input);
+        original.step(input);
+        expected.push_back(snapshot(original));
+    }
+
+    // Feed it back
+    Simulation replayed(SimConfig(), rec.getSeed());
+    rec.rewind();
+    for (int t = 0; t < ticks; t++) {
+        InputRecording::Choice choice;
+        if (rec.takeScreen(InputRecording::SCREEN_GAME_OVER, choice)) {
+            ASSERT_TRUE(replayed.isGameOver());
+            replayed.reset();
+        }
+        ASSERT_TRUE(rec.nextIsTick());
+        replayed.step(rec.takeTick());
+
+        Snapshot s = snapshot(replayed);
+        const Snapshot& e = expected[t];
+        ASSERT_EQ(s.score, e.score) << "tick " << t;
+        ASSERT_EQ(s.lives, e.lives) << "tick " << t;
+        ASSERT_EQ(s.level, e.level) << "tick " << t;
+        ASSERT_EQ(s.sub.x, e.sub.x) << "tick " << t;
+        ASSERT_EQ(s.sub.y, e.sub.y) << "tick " << t;
+        ASSERT_EQ(s.litter, e.litter) << "tick " << t;
+        ASSERT_EQ(s.enemies, e.enemies) << "tick " << t;
+    }
+    EXPECT_TRUE(rec.atEnd());
+}
@@ -9,14 +9,14 @@
 class SubmarineResetTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        texture = nullptr;
+        sprite = SPRITE_SUBMARINE;
     }
     
-    SDL_Texture* texture;
+    int sprite;
 };
 
 TEST_F(SubmarineResetTest, ResetClearsHitBlinkTimer) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     // Start hit blink
     sub.startHitBlink();
@@ -28,32 +28,32 @@ TEST_F(SubmarineResetTest, ResetClearsHitBlinkTimer) {
 }
 
 TEST_F(SubmarineResetTest, ResetPreservesDimensions) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
-    SDL_Rect originalRect = sub.getRect();
+    SimRect originalRect = sub.getRect();
     
     sub.startHitBlink();
     sub.reset();
     
-    SDL_Rect afterReset = sub.getRect();
+    SimRect afterReset = sub.getRect();
     
     EXPECT_EQ(afterReset.w, originalRect.w);
     EXPECT_EQ(afterReset.h, originalRect.h);
 }
 
 TEST_F(SubmarineResetTest, ResetPreservesPosition) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     sub.startHitBlink();
     sub.reset();
     
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     EXPECT_EQ(rect.x, 100);
     EXPECT_EQ(rect.y, 200);
 }
 
 TEST_F(SubmarineResetTest, ResetAfterMovement) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     // Move submarine and take damage
     sub.moveBy(50, 30);
@@ -64,13 +64,13 @@ TEST_F(SubmarineResetTest, ResetAfterMovement) {
     sub.reset();
     EXPECT_FALSE(sub.isInvulnerable());
     
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     EXPECT_EQ(rect.x, 150);  // Position should be preserved
     EXPECT_EQ(rect.y, 230);
 }
 
 TEST_F(SubmarineResetTest, MultipleResetsAreIdempotent) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     sub.startHitBlink();
     sub.reset();
@@ -81,13 +81,13 @@ TEST_F(SubmarineResetTest, MultipleResetsAreIdempotent) {
     sub.reset();
     EXPECT_FALSE(sub.isInvulnerable());
     
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     EXPECT_EQ(rect.x, 100);
     EXPECT_EQ(rect.y, 200);
 }
 
 TEST_F(SubmarineResetTest, ResetDuringBlinkAnimation) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     sub.startHitBlink();
     
@@ -104,7 +104,7 @@ TEST_F(SubmarineResetTest, ResetDuringBlinkAnimation) {
 }
 
 TEST_F(SubmarineResetTest, ResetAndTakeNewDamage) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     // Take damage and reset
     sub.startHitBlink();
@@ -190,14 +190,14 @@ protected:
 //  INTEGRATION RESET TESTS 
 
 TEST(ResetIntegrationTest, ResetGameStateSimulation) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub(texture, 400, 300, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub(sprite, 400, 300, 64, 64);
     
     // Simulate game state
     sub.moveBy(100, 50);
     sub.startHitBlink();
     
-    SDL_Rect positionBeforeReset = sub.getRect();
+    SimRect positionBeforeReset = sub.getRect();
     
     // Reset submarine state
     sub.reset();
@@ -205,14 +205,14 @@ TEST(ResetIntegrationTest, ResetGameStateSimulation) {
     // Verify state is reset correctly
     EXPECT_FALSE(sub.isInvulnerable());
     
-    SDL_Rect positionAfterReset = sub.getRect();
+    SimRect positionAfterReset = sub.getRect();
     EXPECT_EQ(positionAfterReset.x, positionBeforeReset.x);
     EXPECT_EQ(positionAfterReset.y, positionBeforeReset.y);
 }
 
 TEST(ResetIntegrationTest, ResetAfterMultipleHits) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub(texture, 100, 200, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     // Take multiple hits and resets
     for (int i = 0; i < 5; i++) {
@@ -230,9 +230,9 @@ TEST(ResetIntegrationTest, ResetAfterMultipleHits) {
 }
 
 TEST(ResetIntegrationTest, ConcurrentResetOperations) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub1(texture, 100, 100, 64, 64);
-    Submarine sub2(texture, 200, 200, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub1(sprite, 100, 100, 64, 64);
+    Submarine sub2(sprite, 200, 200, 64, 64);
     
     sub1.startHitBlink();
     sub2.startHitBlink();
@@ -250,40 +250,40 @@ TEST(ResetIntegrationTest, ConcurrentResetOperations) {
 //  BOUNDARY RESET TESTS 
 
 TEST(ResetBoundaryTest, ResetWithZeroPosition) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub(texture, 0, 0, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub(sprite, 0, 0, 64, 64);
     
     sub.startHitBlink();
     sub.reset();
     
     EXPECT_FALSE(sub.isInvulnerable());
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     EXPECT_EQ(rect.x, 0);
     EXPECT_EQ(rect.y, 0);
 }
 
 TEST(ResetBoundaryTest, ResetWithLargePosition) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub(texture, 10000, 10000, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub(sprite, 10000, 10000, 64, 64);
     
     sub.startHitBlink();
     sub.reset();
     
     EXPECT_FALSE(sub.isInvulnerable());
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     EXPECT_EQ(rect.x, 10000);
     EXPECT_EQ(rect.y, 10000);
 }
 
 TEST(ResetBoundaryTest, ResetImmediatelyAfterConstruction) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub(texture, 100, 200, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     // Reset immediately without any state changes
     sub.reset();
     
     EXPECT_FALSE(sub.isInvulnerable());
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     EXPECT_EQ(rect.x, 100);
     EXPECT_EQ(rect.y, 200);
 }
@@ -291,8 +291,8 @@ TEST(ResetBoundaryTest, ResetImmediatelyAfterConstruction) {
 //  EDGE CASE RESET TESTS 
 
 TEST(ResetEdgeCaseTest, ResetWithMinimalBlinkTime) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub(texture, 100, 200, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     sub.startHitBlink();
     sub.updateBlink();  // Update just one frame
@@ -302,8 +302,8 @@ TEST(ResetEdgeCaseTest, ResetWithMinimalBlinkTime) {
 }
 
 TEST(ResetEdgeCaseTest, ResetWithMaximalBlinkTime) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub(texture, 100, 200, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     sub.startHitBlink();
     
@@ -318,8 +318,8 @@ TEST(ResetEdgeCaseTest, ResetWithMaximalBlinkTime) {
 }
 
 TEST(ResetEdgeCaseTest, AlternatingResetAndDamage) {
-    SDL_Texture* texture = nullptr;
-    Submarine sub(texture, 100, 200, 64, 64);
+    int sprite = SPRITE_SUBMARINE;
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     for (int i = 0; i < 10; i++) {
         sub.startHitBlink();
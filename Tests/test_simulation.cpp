@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include "../include/Simulation.h"
+
+// Push the simulation to the given level by feeding it litter
+static void advanceToLevel(Simulation& sim, int level) {
+    int frames = 0;
+    while (sim.getLevelNumber() < level && frames < 1000) {
+        SimRect sub = sim.getSubmarine().getRect();
+        sim.getLevel().setEnemyItems({});
+        sim.getLevel().setLitterItems({ Litter(SPRITE_CAN, sub.x + 10.0f, sub.y + 10.0f, 0.0f, 30, 30) });
+        sim.step(SimInput());
+        frames++;
+    }
+}
+
+//  PROGRESSION TESTS 
+
+TEST(SimulationTest, StartsOnLevel1) {
+    Simulation sim;
+    
+    EXPECT_EQ(sim.getLevelNumber(), 1);
+    EXPECT_EQ(sim.getScore(), 0);
+    EXPECT_EQ(sim.getLives(), 3);
+    EXPECT_FALSE(sim.isGameOver());
+    EXPECT_TRUE(std::holds_alternative<Level1*>(sim.getActiveLevel()));
+}
+
+TEST(SimulationTest, LevelThresholds) {
+    EXPECT_EQ(Simulation::levelForScore(90, 1), 1);
+    EXPECT_EQ(Simulation::levelForScore(100, 1), 2);
+    EXPECT_EQ(Simulation::levelForScore(190, 2), 2);
+    EXPECT_EQ(Simulation::levelForScore(200, 2), 3);
+    EXPECT_EQ(Simulation::levelForScore(400, 3), 4);
+    
+    // Only one level at a time
+    EXPECT_EQ(Simulation::levelForScore(400, 1), 2);
+}
+
+TEST(SimulationTest, ScoreToLeaveLevel) {
+    EXPECT_EQ(Simulation::scoreToLeaveLevel(1), 100);
+    EXPECT_EQ(Simulation::scoreToLeaveLevel(2), 200);
+    EXPECT_EQ(Simulation::scoreToLeaveLevel(3), 400);
+    EXPECT_EQ(Simulation::scoreToLeaveLevel(4), -1);
+    EXPECT_EQ(Simulation::levelForScore(5000, 4), 4);
+}
+
+TEST(SimulationTest, CollectingLitterAdvancesLevel) {
+    Simulation sim;
+    
+    // Park litter right under the submarine each frame until we reach Level 2
+    SimRect sub = sim.getSubmarine().getRect();
+    int frames = 0;
+    while (sim.getLevelNumber() == 1 && frames < 100) {
+        sim.getLevel().setLitterItems({ Litter(SPRITE_CAN, sub.x + 10.0f, sub.y + 10.0f, 0.0f, 30, 30) });
+        sim.step(SimInput());
+        frames++;
+    }
+    
+    EXPECT_EQ(sim.getLevelNumber(), 2);
+    EXPECT_EQ(sim.getScore(), 100);
+    EXPECT_TRUE(std::holds_alternative<Level2*>(sim.getActiveLevel()));
+    
+    bool sawLevelChange = false;
+    for (const auto& e : sim.getEvents()) {
+        if (e.type == SimEventType::LevelChanged && e.value == 2) sawLevelChange = true;
+    }
+    EXPECT_TRUE(sawLevelChange);
+}
+
+TEST(SimulationTest, InputMovesSubmarine) {
+    Simulation sim;
+    SimRect before = sim.getSubmarine().getRect();
+    
+    SimInput input;
+    input.right = true;
+    input.down = true;
+    sim.step(input);
+    
+    SimRect after = sim.getSubmarine().getRect();
+    EXPECT_EQ(after.x, before.x + 5);
+    EXPECT_EQ(after.y, before.y + 5);
+}
+
+//  LIVES / GAME OVER TESTS 
+
+TEST(SimulationTest, ThreeHitsEndTheGame) {
+    Simulation sim;
+    advanceToLevel(sim, 2);  // No animals in Level 1
+    
+    for (int hit = 0; hit < 3; hit++) {
+        SimRect sub = sim.getSubmarine().getRect();
+        sim.getLevel().setLitterItems({});
+        sim.getLevel().setEnemyItems({ Enemies(SPRITE_EEL, sub.x + 20.0f, sub.y + 20.0f, 0.0f, 70, 30, 1) });
+        sim.step(SimInput());
+    }
+    
+    EXPECT_EQ(sim.getLives(), 0);
+    EXPECT_TRUE(sim.isGameOver());
+    EXPECT_FALSE(sim.isVictory());
+    
+    // No more updates once the game is over
+    SimInput input;
+    input.right = true;
+    SimRect before = sim.getSubmarine().getRect();
+    sim.step(input);
+    EXPECT_EQ(sim.getSubmarine().getRect().x, before.x);
+}
+
+TEST(SimulationTest, ResetRestoresStartingState) {
+    Simulation sim;
+    SimInput input;
+    input.up = true;
+    for (int i = 0; i < 30; i++) sim.step(input);
+    
+    sim.reset();
+    
+    EXPECT_EQ(sim.getLevelNumber(), 1);
+    EXPECT_EQ(sim.getScore(), 0);
+    EXPECT_EQ(sim.getLives(), 3);
+    EXPECT_EQ(sim.getSubmarine().getRect().x, 200);
+    EXPECT_EQ(sim.getSubmarine().getRect().y, 275);
+}
+
+TEST(SimulationTest, LevelChangeKeepsTheSameWorld) {
+    Simulation sim;
+    const std::vector<Litter>* litter = &sim.getLevel().getLitterItems();
+    const std::vector<Enemies>* enemies = &sim.getLevel().getEnemyItems();
+
+    // Collect the last piece needed with another one still floating about
+    while (sim.getLevelNumber() < 2) {
+        SimRect sub = sim.getSubmarine().getRect();
+        sim.getLevel().setLitterItems({ Litter(SPRITE_CAN, sub.x + 10.0f, sub.y + 10.0f, 0.0f, 30, 30),
+                                        Litter(SPRITE_BAG, 500.0f, 100.0f, 0.0f, 30, 30) });
+        sim.step(SimInput());
+    }
+
+    // Level 2 works on the very same lists, nothing was copied across
+    EXPECT_EQ(&sim.getLevel().getLitterItems(), litter);
+    EXPECT_EQ(&sim.getLevel().getEnemyItems(), enemies);
+    ASSERT_EQ(litter->size(), 2u);
+    EXPECT_FALSE((*litter)[0].active);
+    EXPECT_TRUE((*litter)[1].active);
+    EXPECT_EQ((*litter)[1].x, 500.0f);
+
+    // The storm starts from open water, still in the same world
+    advanceToLevel(sim, 4);
+    EXPECT_EQ(&sim.getLevel().getLitterItems(), litter);
+    EXPECT_TRUE(litter->empty());
+    EXPECT_TRUE(enemies->empty());
+}
+
+TEST(SimulationTest, ResetReusesTheLevels) {
+    Simulation sim;
+    const Level* level1 = &sim.getLevel();
+    advanceToLevel(sim, 4);
+    ASSERT_EQ(sim.getLevelNumber(), 4);
+    const Level* level4 = &sim.getLevel();
+
+    // Same objects every time round, nothing new is made
+    sim.reset();
+    EXPECT_EQ(&sim.getLevel(), level1);
+    advanceToLevel(sim, 4);
+    EXPECT_EQ(&sim.getLevel(), level4);
+}
+
+TEST(SimulationTest, ResetWithSeedPlaysLikeANewSimulation) {
+    // Something that moves about, collects and gets hit
+    auto inputAt = [](int tick) {
+        SimInput input;
+        input.up = (tick / 40) % 3 == 0;
+        input.down = (tick / 40) % 3 == 1;
+        input.right = (tick / 90) % 2 == 0;
+        input.left = !input.right;
+        input.calm = tick % 100 == 0;
+        return input;
+    };
+
+    Simulation used(SimConfig(), 5);
+    for (int tick = 0; tick < 2000; tick++) used.step(inputAt(tick));
+
+    used.reset(11);
+    Simulation fresh(SimConfig(), 11);
+    EXPECT_EQ(used.getSeed(), 11u);
+    for (int tick = 0; tick < 4000 && !fresh.isGameOver(); tick++) {
+        used.step(inputAt(tick));
+        fresh.step(inputAt(tick));
+        ASSERT_EQ(used.getScore(), fresh.getScore()) << "tick " << tick;
+        ASSERT_EQ(used.getLives(), fresh.getLives()) << "tick " << tick;
+        ASSERT_EQ(used.getLevelNumber(), fresh.getLevelNumber()) << "tick " << tick;
+        ASSERT_EQ(used.getLevel().getEnemyItems().size(), fresh.getLevel().getEnemyItems().size()) << "tick " << tick;
+        ASSERT_EQ(used.getSubmarine().getRect().x, fresh.getSubmarine().getRect().x) << "tick " << tick;
+    }
+    EXPECT_EQ(used.isGameOver(), fresh.isGameOver());
+}
+
+TEST(SimulationTest, Next64DrawsTheHighHalfFirst) {
+    // Level seeds come from next64(), so its order must not depend on the compiler
+    Rng a(42), b(42);
+    uint64_t hi = b.next();
+    uint64_t lo = b.next();
+    EXPECT_EQ(a.next64(), (hi << 32) | lo);
+}
+
+//  LEVEL 4 TESTS 
+
+TEST(SimulationTest, Level4IntroPausesGameplay) {
+    Simulation sim;
+    advanceToLevel(sim, 4);
+    
+    ASSERT_EQ(sim.getLevelNumber(), 4);
+    EXPECT_TRUE(sim.isShowingLevel4Intro());
+    
+    ASSERT_TRUE(std::holds_alternative<Level4*>(sim.getActiveLevel()));
+    Level4* level4 = std::get<Level4*>(sim.getActiveLevel());
+    EXPECT_EQ(static_cast<Level*>(level4), &sim.getLevel());
+    
+    for (int i = 0; i < 179; i++) sim.step(SimInput());
+    EXPECT_TRUE(sim.isShowingLevel4Intro());
+    EXPECT_EQ(level4->getStormTimer(), 1800);
+    
+    sim.step(SimInput());
+    EXPECT_FALSE(sim.isShowingLevel4Intro());
+}
+
+TEST(SimulationTest, SurvivingTheStormIsVictory) {
+    Simulation sim;
+    advanceToLevel(sim, 4);
+    ASSERT_EQ(sim.getLevelNumber(), 4);
+    
+    bool stormWarning = false;
+    int frames = 0;
+    while (!sim.isGameOver() && frames < 5000) {
+        // Keep animals away so the run can't be lost
+        sim.getLevel().setEnemyItems({});
+        sim.step(SimInput());
+        for (const auto& e : sim.getEvents()) {
+            if (e.type == SimEventType::StormWarning) stormWarning = true;
+        }
+        frames++;
+    }
+    
+    EXPECT_TRUE(sim.isGameOver());
+    EXPECT_TRUE(sim.isVictory());
+    EXPECT_TRUE(stormWarning);
+    EXPECT_EQ(sim.getLives(), 3);
+}
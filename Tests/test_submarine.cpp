@@ -9,19 +9,19 @@ using ::testing::_;
 class SubmarineTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        // Mock texture (nullptr for unit tests)
-        texture = nullptr;
+        // Sprite ID only, no texture needed for unit tests
+        sprite = SPRITE_SUBMARINE;
     }
 
-    SDL_Texture* texture;
+    int sprite;
 };
 
 //  ASSERTION TESTS 
 
 TEST_F(SubmarineTest, InitialPosition) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     EXPECT_EQ(rect.x, 100);
     EXPECT_EQ(rect.y, 200);
     EXPECT_EQ(rect.w, 64);
@@ -29,39 +29,39 @@ TEST_F(SubmarineTest, InitialPosition) {
 }
 
 TEST_F(SubmarineTest, SetPosition) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     sub.setPosition(150, 250);
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     
     EXPECT_EQ(rect.x, 150);
     EXPECT_EQ(rect.y, 250);
 }
 
 TEST_F(SubmarineTest, MoveBy) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     sub.moveBy(50, -30);
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     
     EXPECT_EQ(rect.x, 150);
     EXPECT_EQ(rect.y, 170);
 }
 
 TEST_F(SubmarineTest, Clamping) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     // Move outside bounds
     sub.setPosition(-50, -50);
     sub.clamp(0, 800, 0, 600);
     
-    SDL_Rect rect = sub.getRect();
+    SimRect rect = sub.getRect();
     EXPECT_GE(rect.x, 0);
     EXPECT_GE(rect.y, 0);
 }
 
 TEST_F(SubmarineTest, InvulnerabilityAfterHit) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     EXPECT_FALSE(sub.isInvulnerable());
     
@@ -70,7 +70,7 @@ TEST_F(SubmarineTest, InvulnerabilityAfterHit) {
 }
 
 TEST_F(SubmarineTest, BlinkUpdate) {
-    Submarine sub(texture, 100, 200, 64, 64);
+    Submarine sub(sprite, 100, 200, 64, 64);
     
     sub.startHitBlink();
     EXPECT_TRUE(sub.isInvulnerable());
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "../include/SpatialGrid.h"
+
+// Broadphase vs. linear scan. The world grows with the entity count so the
+// number of entities near any one spot stays about the same (like a wider
+// Level 4 stream). Grid queries should stay flat while the scan grows.
+
+namespace {
+
+struct Scene {
+    std::vector<SimRect> rects;
+    std::vector<SimRect> queries;   // Submarine-sized probes
+    int worldW, worldH;
+};
+
+Scene makeScene(int count) {
+    // ~1 entity per 4800 px^2, same density as ~100 litter on an 800x600 screen
+    float scale = std::sqrt(count / 100.0f);
+    Scene s;
+    s.worldW = int(800 * scale) + 1;
+    s.worldH = int(600 * scale) + 1;
+
+    srand(42);
+    for (int i = 0; i < count; i++) {
+        s.rects.push_back({ rand() % s.worldW, rand() % s.worldH, 30 + rand() % 20, 40 + rand() % 40 });
+    }
+    for (int i = 0; i < 256; i++) {
+        s.queries.push_back({ rand() % s.worldW, rand() % s.worldH, 112, 112 });
+    }
+    return s;
+}
+
+void BM_GridQueryRect(benchmark::State& state) {
+    Scene scene = makeScene(int(state.range(0)));
+    SpatialGrid grid(64, 0, 0, scene.worldW, scene.worldH);
+    for (int i = 0; i < (int)scene.rects.size(); i++) grid.insert(i, scene.rects[i]);
+
+    std::vector<int> hits;
+    size_t q = 0;
+    for (auto _ : state) {
+        grid.queryRect(scene.queries[q++ & 255], hits);
+        benchmark::DoNotOptimize(hits.data());
+    }
+}
+BENCHMARK(BM_GridQueryRect)->RangeMultiplier(10)->Range(100, 100000);
+
+void BM_GridQueryRadius(benchmark::State& state) {
+    Scene scene = makeScene(int(state.range(0)));
+    SpatialGrid grid(64, 0, 0, scene.worldW, scene.worldH);
+    for (int i = 0; i < (int)scene.rects.size(); i++) grid.insert(i, scene.rects[i]);
+
+    std::vector<int> hits;
+    size_t q = 0;
+    for (auto _ : state) {
+        const SimRect& probe = scene.queries[q++ & 255];
+        grid.queryRadius(float(probe.x), float(probe.y), 150.0f, hits);  // Calm pulse radius
+        benchmark::DoNotOptimize(hits.data());
+    }
+}
+BENCHMARK(BM_GridQueryRadius)->RangeMultiplier(10)->Range(100, 100000);
+
+void BM_LinearScan(benchmark::State& state) {
+    Scene scene = makeScene(int(state.range(0)));
+
+    std::vector<int> hits;
+    size_t q = 0;
+    for (auto _ : state) {
+        const SimRect& probe = scene.queries[q++ & 255];
+        hits.clear();
+        for (int i = 0; i < (int)scene.rects.size(); i++) {
+            if (rectsOverlap(probe, scene.rects[i])) hits.push_back(i);
+        }
+        benchmark::DoNotOptimize(hits.data());
+    }
+}
+BENCHMARK(BM_LinearScan)->RangeMultiplier(10)->Range(100, 100000);
+
+// Rebuilding is O(n); this is the per-tick price for the flat queries
+void BM_GridRebuild(benchmark::State& state) {
+    Scene scene = makeScene(int(state.range(0)));
+    SpatialGrid grid(64, 0, 0, scene.worldW, scene.worldH);
+
+    for (auto _ : state) {
+        grid.clear();
+        for (int i = 0; i < (int)scene.rects.size(); i++) grid.insert(i, scene.rects[i]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GridRebuild)->RangeMultiplier(10)->Range(100, 100000);
+
+}  // namespace
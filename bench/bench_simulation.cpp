@@ -0,0 +1,344 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <vector>
+#include "../include/JobPool.h"
+#include "../include/Level.h"
+#include "../include/StateRaster.h"
+#include "../include/TideSweeperEnv.h"
+
+// Per-tick cost of the simulation hot paths, by entity count (10 to 100k).
+// Only the headless core is linked, so nothing here needs a window or a
+// renderer. Levels are filled far past what the game ever spawns to show
+// how each pass scales.
+//
+// Entities drift off screen and get removed as ticks run, so benchmarks
+// that update a level put its starting population back every
+// REFRESH_TICKS iterations (outside the timed region).
+
+namespace {
+
+const int REFRESH_TICKS = 64;
+
+// Spread across the screen and a bit past the right edge
+std::vector<Litter> makeLitter(int count, const SimConfig& config) {
+    std::vector<Litter> litter;
+    litter.reserve(count);
+    for (int i = 0; i < count; i++) {
+        int type = rand() % LITTER_TYPE_COUNT;
+        litter.emplace_back(SPRITE_CAN + type, float(rand() % 900), float(rand() % 500 + 50),
+                            2.0f + rand() % 3, config.litterWidths[type], config.litterHeights[type]);
+    }
+    return litter;
+}
+
+std::vector<Enemies> makeEnemies(int count, const SimConfig& config, bool octopus, bool sharks) {
+    std::vector<Enemies> enemies;
+    enemies.reserve(count);
+    for (int i = 0; i < count; i++) {
+        int type;
+        do {
+            type = rand() % ENEMY_TYPE_COUNT;
+        } while ((type == 2 && !octopus) || (type == 4 && !sharks));
+        enemies.emplace_back(SPRITE_SWORDFISH + type, float(rand() % 900), float(rand() % 500 + 50),
+                             3.0f + rand() % 4, config.enemyWidths[type], config.enemyHeights[type], type);
+    }
+    return enemies;
+}
+
+// Submarine parked out of the way so collisions don't dominate
+Submarine makeSubmarine(const SimConfig& config) {
+    return Submarine(SPRITE_SUBMARINE, 60, 275, config.submarineWidth, config.submarineHeight);
+}
+
+// Level 3 keeps updateInk (from Level) protected
+class BenchLevel3 : public Level3 {
+public:
+    using Level3::Level3;
+    using Level3::updateEnemies;
+    using Level3::updateInk;
+
+    void setOilSpots(int count) {
+        oilSpots.clear();
+        for (int i = 0; i < count; i++) {
+            // Staggered ages so every fade stage is hit
+            oilSpots.push_back({ rand() % 800, rand() % 600, 250 + rand() % 150, rand() % 100, 0.5f });
+        }
+    }
+};
+
+//  LEVEL UPDATES
+
+void BM_Level1Update(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    Level1 level(config);
+    Submarine sub = makeSubmarine(config);
+    std::vector<Litter> litter = makeLitter(int(state.range(0)), config);
+    std::vector<SimEvent> events;
+
+    int ticks = 0;
+    level.setLitterItems(litter);
+    for (auto _ : state) {
+        if (++ticks % REFRESH_TICKS == 0) {
+            state.PauseTiming();
+            level.setLitterItems(litter);
+            state.ResumeTiming();
+        }
+        events.clear();
+        level.update(sub, events);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Level1Update)->RangeMultiplier(10)->Range(10, 100000);
+
+// Litter and animals together, like a full Level 2 tick
+void BM_Level2Update(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    Level2 level(config);
+    Submarine sub = makeSubmarine(config);
+    std::vector<Litter> litter = makeLitter(int(state.range(0)), config);
+    std::vector<Enemies> enemies = makeEnemies(int(state.range(0)), config, false, true);
+    std::vector<SimEvent> events;
+
+    int ticks = 0;
+    level.setLitterItems(litter);
+    level.setEnemyItems(enemies);
+    for (auto _ : state) {
+        if (++ticks % REFRESH_TICKS == 0) {
+            state.PauseTiming();
+            level.setLitterItems(litter);
+            level.setEnemyItems(enemies);
+            state.ResumeTiming();
+        }
+        events.clear();
+        level.update(sub, events);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_Level2Update)->RangeMultiplier(10)->Range(10, 100000);
+
+// Same tick with the entity passes split across a pool (one thread per
+// core). Below the default grain it's the serial path plus a branch.
+void BM_Level2UpdatePooled(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    JobPool pool;
+    Level2 level(config);
+    level.setJobPool(&pool, Level::DEFAULT_JOB_GRAIN);
+    Submarine sub = makeSubmarine(config);
+    std::vector<Litter> litter = makeLitter(int(state.range(0)), config);
+    std::vector<Enemies> enemies = makeEnemies(int(state.range(0)), config, false, true);
+    std::vector<SimEvent> events;
+
+    int ticks = 0;
+    level.setLitterItems(litter);
+    level.setEnemyItems(enemies);
+    for (auto _ : state) {
+        if (++ticks % REFRESH_TICKS == 0) {
+            state.PauseTiming();
+            level.setLitterItems(litter);
+            level.setEnemyItems(enemies);
+            state.ResumeTiming();
+        }
+        events.clear();
+        level.update(sub, events);
+    }
+    state.counters["threads"] = pool.getThreadCount();
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_Level2UpdatePooled)->RangeMultiplier(10)->Range(10, 100000)->UseRealTime();
+
+//  ENEMY UPDATES
+
+void BM_Level2UpdateEnemies(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    Level2 level(config);
+    Submarine sub = makeSubmarine(config);
+    std::vector<Enemies> enemies = makeEnemies(int(state.range(0)), config, false, true);
+    std::vector<SimEvent> events;
+
+    int ticks = 0;
+    level.setEnemyItems(enemies);
+    for (auto _ : state) {
+        if (++ticks % REFRESH_TICKS == 0) {
+            state.PauseTiming();
+            level.setEnemyItems(enemies);
+            state.ResumeTiming();
+        }
+        events.clear();
+        level.updateEnemies(sub, events);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Level2UpdateEnemies)->RangeMultiplier(10)->Range(10, 100000);
+
+void BM_Level3UpdateEnemies(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    BenchLevel3 level(config);
+    Submarine sub = makeSubmarine(config);
+    std::vector<Enemies> enemies = makeEnemies(int(state.range(0)), config, true, true);
+    std::vector<SimEvent> events;
+
+    int ticks = 0;
+    level.setEnemyItems(enemies);
+    for (auto _ : state) {
+        if (++ticks % REFRESH_TICKS == 0) {
+            state.PauseTiming();
+            level.setEnemyItems(enemies);
+            state.ResumeTiming();
+        }
+        events.clear();
+        level.updateEnemies(sub, events);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Level3UpdateEnemies)->RangeMultiplier(10)->Range(10, 100000);
+
+void BM_Level4UpdateEnemies(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    Level4 level(config);
+    Submarine sub = makeSubmarine(config);
+    std::vector<Enemies> enemies = makeEnemies(int(state.range(0)), config, false, false);
+    std::vector<SimEvent> events;
+
+    int ticks = 0;
+    level.setEnemyItems(enemies);
+    for (auto _ : state) {
+        if (++ticks % REFRESH_TICKS == 0) {
+            state.PauseTiming();
+            level.setEnemyItems(enemies);
+            state.ResumeTiming();
+        }
+        events.clear();
+        level.updateEnemies(sub, events);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Level4UpdateEnemies)->RangeMultiplier(10)->Range(10, 100000);
+
+//  LEVEL 3 INK
+
+// Spawning from octopuses plus fading that many existing spots
+void BM_Level3Ink(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    BenchLevel3 level(config);
+    std::vector<Enemies> octopuses;
+    for (int i = 0; i < state.range(0); i++) {
+        octopuses.emplace_back(SPRITE_OCTOPUS, float(rand() % 800), float(rand() % 600), 3.0f,
+                               config.enemyWidths[2], config.enemyHeights[2], 2);
+    }
+    level.setEnemyItems(octopuses);
+
+    int ticks = 0;
+    level.setOilSpots(int(state.range(0)));
+    for (auto _ : state) {
+        if (++ticks % REFRESH_TICKS == 0) {
+            state.PauseTiming();
+            level.setOilSpots(int(state.range(0)));
+            state.ResumeTiming();
+        }
+        level.updateInk();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Level3Ink)->RangeMultiplier(10)->Range(10, 100000);
+
+//  CALM PULSE
+
+void BM_CalmEnemies(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    Level2 level(config);
+    std::vector<Enemies> enemies = makeEnemies(int(state.range(0)), config, false, true);
+
+    for (auto _ : state) {
+        // Calmed enemies are skipped, so every pulse starts from fresh ones
+        state.PauseTiming();
+        level.setEnemyItems(enemies);
+        state.ResumeTiming();
+        level.calmEnemies(400.0f, 300.0f, 150.0f);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CalmEnemies)->RangeMultiplier(10)->Range(10, 100000);
+
+//  SINGLE ENTITY PASSES
+
+void BM_LitterCheckCollision(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    std::vector<Litter> litter = makeLitter(int(state.range(0)), config);
+    SimRect subRect = makeSubmarine(config).getRect();
+
+    for (auto _ : state) {
+        int hits = 0;
+        for (Litter& l : litter) {
+            hits += l.checkCollision(subRect);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LitterCheckCollision)->RangeMultiplier(10)->Range(10, 100000);
+
+void BM_EnemiesUpdate(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    std::vector<Enemies> enemies = makeEnemies(int(state.range(0)), config, true, true);
+
+    for (auto _ : state) {
+        for (Enemies& e : enemies) {
+            e.update(400.0f, 300.0f);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EnemiesUpdate)->RangeMultiplier(10)->Range(10, 100000);
+
+//  OBSERVATION RASTER
+
+// Litter and animals of every type plus ink, into the 80x60 grid
+void BM_StateRaster(benchmark::State& state) {
+    srand(42);
+    SimConfig config;
+    BenchLevel3 level(config);
+    Submarine sub = makeSubmarine(config);
+    level.setLitterItems(makeLitter(int(state.range(0)), config));
+    level.setEnemyItems(makeEnemies(int(state.range(0)), config, true, true));
+    level.setOilSpots(int(state.range(0)) / 10);
+    StateRaster raster;
+
+    for (auto _ : state) {
+        raster.rasterize(level, sub);
+        benchmark::DoNotOptimize(raster.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_StateRaster)->RangeMultiplier(10)->Range(10, 10000);
+
+//  RL ENVIRONMENT
+
+// Whole-game steps (sim tick + observation) for K environments on all cores
+void BM_VecEnvStep(benchmark::State& state) {
+    int count = int(state.range(0));
+    VecEnv envs(count);
+    envs.reset(42);
+    std::vector<int> actions(count);
+    int t = 0;
+
+    for (auto _ : state) {
+        for (int i = 0; i < count; i++) actions[i] = (t / 10 + i) % TideSweeperEnv::ACTION_COUNT;
+        envs.step(actions.data());
+        t++;
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_VecEnvStep)->RangeMultiplier(4)->Range(1, 256)->UseRealTime();
+
+}  // namespace
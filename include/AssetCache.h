@@ -0,0 +1,79 @@
+#pragma once
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include <map>
+#include <string>
+
+class AssetLoader;
+
+// Process-wide cache of images, textures, sound effects and music, keyed
+// by path (fonts have their own registry, FontManager).
+//
+// acquire*() loads a file the first time it's asked for and hands out the
+// same pointer after that; every acquire is paired with a release(). An
+// asset nobody holds stays loaded, so a new GameManager or Menu finds
+// everything from the last one and never goes back to disk. purgeUnused()
+// frees what isn't held right now and shutdown() frees the lot (before the
+// renderer and the audio device go away).
+//
+// Failed loads are remembered too (as nullptr) so a missing file is only
+// reported once. Main thread only. Textures all belong to the one renderer
+// the game makes.
+class AssetCache {
+public:
+    // Decoded image, for things that read pixels or sizes (the sprite atlas)
+    static SDL_Surface* acquireImage(const std::string& path);
+
+    // Uploaded image. If `loader` is given and the texture isn't cached, it
+    // comes from the loader (which may have decoded it in the background).
+    static SDL_Texture* acquireTexture(SDL_Renderer* renderer, const std::string& path,
+                                       AssetLoader* loader = nullptr);
+
+    static Mix_Chunk* acquireChunk(const std::string& path);
+    static Mix_Music* acquireMusic(const std::string& path);
+
+    // Give back an acquired asset (nullptr is fine). It stays cached.
+    static void release(SDL_Surface* image);
+    static void release(SDL_Texture* texture);
+    static void release(Mix_Chunk* chunk);
+    static void release(Mix_Music* music);
+
+    // Already loaded (or already failed) as a texture
+    static bool hasTexture(const std::string& path);
+
+    // Handles held on `path`, across every kind of asset
+    static int getRefCount(const std::string& path);
+
+    // Files read from disk so far
+    static int getLoadCount() { return loadCount; }
+
+    // Free everything that isn't acquired right now
+    static void purgeUnused();
+
+    // Free everything, acquired or not
+    static void shutdown();
+
+private:
+    template <typename T>
+    struct Entry {
+        T* asset;
+        int refs;
+    };
+
+    static std::map<std::string, Entry<SDL_Surface>>& images();
+    static std::map<std::string, Entry<SDL_Texture>>& textures();
+    static std::map<std::string, Entry<Mix_Chunk>>& chunks();
+    static std::map<std::string, Entry<Mix_Music>>& music();
+
+    static void freeAsset(SDL_Surface* image);
+    static void freeAsset(SDL_Texture* texture);
+    static void freeAsset(Mix_Chunk* chunk);
+    static void freeAsset(Mix_Music* music);
+
+    template <typename T>
+    static void releaseIn(std::map<std::string, Entry<T>>& entries, T* asset);
+    template <typename T>
+    static void purgeIn(std::map<std::string, Entry<T>>& entries, bool all);
+
+    static int loadCount;
+};
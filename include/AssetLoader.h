@@ -0,0 +1,48 @@
+#pragma once
+#include <SDL.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Decodes PNGs on worker threads.
+// request() queues a file; a worker turns it into an SDL_Surface with
+// IMG_Load. takeTexture() is called on the render thread and only does the
+// texture upload. If the image isn't decoded yet it waits for it (or decodes
+// it right there if nobody asked for it), so it always returns something
+// usable, just slower when nothing was prefetched.
+class AssetLoader {
+public:
+    AssetLoader(int threadCount = 2);
+    ~AssetLoader();
+
+    // Start decoding `path` in the background (no-op if already queued/loaded)
+    void request(const std::string& path);
+
+    // True once `path` has been decoded (or failed to)
+    bool isReady(const std::string& path);
+
+    // Upload the decoded image and forget it. nullptr if the file failed to load.
+    SDL_Texture* takeTexture(SDL_Renderer* renderer, const std::string& path);
+
+private:
+    enum class State { Queued, Loading, Done };
+
+    struct Job {
+        State state;
+        SDL_Surface* surface;
+    };
+
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable workAvailable;   // Workers wait on this
+    std::condition_variable jobFinished;     // takeTexture waits on this
+    std::deque<std::string> queue;
+    std::map<std::string, Job> jobs;
+    bool stopping;
+};
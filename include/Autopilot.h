@@ -0,0 +1,20 @@
+#pragma once
+#include "Simulation.h"
+
+// Heuristic bot that plays the game through SimInput, like a player would
+// (--autopilot, soak tests, and the "autopilot" policy in tidesweeper-sim).
+//
+// Each tick it heads for the closest on-screen litter, discounting pieces
+// that have an animal next to them, steers away from animals that get close
+// (sharks from further out, since they chase), and fires the calm pulse
+// when an animal is inside its radius. It only reads the simulation, so
+// the same state always gives the same input.
+class Autopilot {
+public:
+    static constexpr float CALM_RADIUS = 150.0f;     // Same as the SPACE pulse
+    static constexpr float AVOID_RADIUS = 170.0f;    // Animals closer than this push us away
+    static constexpr float SHARK_AVOID_RADIUS = 260.0f;
+    static constexpr float DEAD_ZONE = 4.0f;         // Don't twitch around the target
+
+    static SimInput decide(const Simulation& sim);
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "SimTypes.h"
+
+// Monte Carlo balance runs: lots of headless games, each with its own seed
+// and a simple scripted input policy, spread over all cores. Every game is
+// boiled down to a RunStats row, so designers can compare tuning changes
+// (enemy speeds, spawn rates, storm length in SimConfig) without playing.
+// The tidesweeper-sim tool is a command line around this.
+class BalanceSim {
+public:
+    enum class Policy {
+        Idle,     // Never touches the keys
+        Random,   // Random key combos, held for a while
+        Chase,    // Heads for the nearest litter, calms animals that get close
+        Autopilot // The --autopilot bot: also steers around animals
+    };
+
+    static bool parsePolicy(const std::string& name, Policy& policy);
+    static const char* policyName(Policy policy);
+
+    struct RunStats {
+        uint64_t seed = 0;
+        int ticks = 0;                          // Frames played (60 per second)
+        int levelTicks[3] = { -1, -1, -1 };     // Frame Level 2/3/4 started (100/200/400 points), -1 if never
+        int livesLost[ENEMY_TYPE_COUNT] = {};   // By the animal that hit us
+        int litterCollected = 0;
+        int litterMissed = 0;
+        int finalScore = 0;
+        int finalLevel = 1;
+        int level4Score = -1;                   // Final score if the game got to Level 4, else -1
+        bool victory = false;
+        bool gameOver = false;                  // Out of lives (neither means maxTicks ran out)
+    };
+
+    struct Options {
+        SimConfig config;
+        Policy policy = Policy::Random;
+        int runs = 1000;
+        uint64_t seed = 1;               // Run i plays seed + i
+        int maxTicks = 60 * 60 * 10;     // Give up after 10 game minutes
+        int threads = 0;                 // 0 = one per core
+    };
+
+    // One game from the start until victory, game over or maxTicks
+    static RunStats runGame(const SimConfig& config, uint64_t seed, Policy policy, int maxTicks);
+
+    // options.runs games over options.threads threads. Results come back in
+    // run order and don't depend on the thread count.
+    static std::vector<RunStats> runBatch(const Options& options);
+
+    // One row per run
+    static void writeCsv(std::ostream& out, const std::vector<RunStats>& runs);
+
+    // Settings plus one object per run
+    static void writeJson(std::ostream& out, const Options& options, const std::vector<RunStats>& runs);
+};
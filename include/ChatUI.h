@@ -4,6 +4,7 @@
 #include <SDL_image.h>
 #include <string>
 #include <vector>
+#include "TextRenderer.h"
 
 struct ChatMessage {
     std::string sender;
@@ -75,13 +76,17 @@ private:
 
     TTF_Font* briefFont = nullptr;
 
+    // Glyph atlases for chatFont and briefFont
+    TextRenderer* chatText = nullptr;
+    TextRenderer* briefText = nullptr;
+
 
     // Active response buttons
     std::vector<Button> responseButtons;
 
     // helpers
    void renderText(const std::string& text, SDL_Color color,
-                SDL_Rect& rect, bool wrap = false, TTF_Font* overrideFont = nullptr);
+                SDL_Rect& rect, bool wrap = false, TextRenderer* overrideText = nullptr);
 
 
     void renderBubble(int x, int y, int w, int h, SDL_Color color);
@@ -1,31 +1,32 @@
 #pragma once
-#include <SDL.h>
-#include <SDL_image.h>
+#include "SimTypes.h"
 
+// Fields are ordered hot to cold (what every update and query reads
+// first, the calm/fall state after) with the flags packed together, so an
+// animal is 56 bytes instead of 72.
 class Enemies {
 public: 
-    SDL_Texture* texture; 
+    static constexpr float DETECTION_RADIUS = 200.0f;   // Sharks chase inside this
+
     float x, y; 
     float speed;        
-    bool active;
-    int respawnTimer;
     int width, height;
-    float detectionRadius = 200.0f; 
+    int enemyType = 0;      // 0=Swordfish, 1=Eel, 2=Octopus, 3=Angler, 4=Shark
+    int sprite;             // Sprite ID used by the renderer
     int hitBlinkTimer = 0;  
-    bool falling = false;   
     float fallSpeed = 0;    
-    int enemyType = 0;      // 0=Swordfish, 1=Eel, 2=Octopus, 3=Angler, 4=Shark
-    bool calmed = false;    
-    bool deflecting = false; 
     float deflectDirX = 0;   
     float deflectDirY = 0;
     int deflectTimer = 0;   
+    bool active;
+    bool falling = false;   
+    bool calmed = false;    
+    bool deflecting = false; 
     bool facingRight = false; 
 
-    Enemies(SDL_Texture* tex, float startX, float startY, float moveSpeed, int w = 90, int h = 90, int type = 0);
+    Enemies(int sprite, float startX, float startY, float moveSpeed, int w = 90, int h = 90, int type = 0);
     void update(float subX, float subY); 
-    void render(SDL_Renderer* renderer);
-    bool checkCollision(const SDL_Rect& subRect);
+    bool checkCollision(const SimRect& subRect);
     void startHitBlink();  
     void startFalling();   
 };
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Structure-of-arrays storage for large numbers of simple moving entities
+// (Level 4's litter flow). Each field is its own contiguous array, so the
+// per-frame passes below are plain loops over floats that the compiler
+// can vectorize, with no per-item branching on type.
+//
+// Only the fields touched every frame are kept here (hot data). Rarely
+// used state like Litter::respawnTimer has no column; nothing in the flow
+// needs it.
+//
+// Only the flow lives here. Animals and the classic litter stay as objects
+// (Enemies, Litter): there are at most a dozen of them, their updates
+// branch on type and calm/fall state, and the renderer, autopilot, env and
+// replays all read them as objects.
+//
+// Live entities are always packed into [0, size()). remove() swaps the
+// last entity into the gap, and storage is reserved up front so adding
+// never reallocates while there's room.
+class EntityStore {
+public:
+    // Bits in flags[]
+    enum : uint8_t {
+        FLAG_ACTIVE  = 1,
+    };
+
+    EntityStore() {}
+
+    // Allocate room for `capacity` entities (call before play)
+    void reserve(int capacity);
+    int capacity() const { return maxCount; }
+    int size() const { return (int)x.size(); }
+    bool empty() const { return x.empty(); }
+    bool full() const { return size() >= maxCount; }
+    void clear();
+
+    // Returns the new index, or -1 if the store is full
+    int add(int spriteId, float startX, float startY, float moveSpeed, int w, int h);
+
+    // Swap-remove (the last entity moves into `index`)
+    void remove(int index);
+
+    // Drop every entity without FLAG_ACTIVE
+    void removeInactive();
+
+    // x -= speed for everything. The range versions only touch
+    // [begin, end), for splitting a pass across threads.
+    void driftLeft() { driftLeft(0, size()); }
+    void driftLeft(int begin, int end);
+
+    // Clear FLAG_ACTIVE on anything left of minX
+    void deactivateLeftOf(float minX) { deactivateLeftOf(minX, 0, size()); }
+    void deactivateLeftOf(float minX, int begin, int end);
+
+    // Hot arrays, all size() long
+    std::vector<float> x, y;
+    std::vector<float> speed;
+    std::vector<int> width, height;
+    std::vector<int> sprite;
+    std::vector<uint8_t> flags;
+
+private:
+    int maxCount = 0;
+};
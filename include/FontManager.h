@@ -0,0 +1,45 @@
+#pragma once
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <map>
+#include <string>
+#include <utility>
+
+// The one font every screen uses
+const char* const UI_FONT_PATH = "Assets/fonts/OpenSans.ttf";
+
+// Process-wide font registry.
+// Each (path, size) is opened once on first use and the same TTF_Font* is
+// handed to everyone who asks for it afterwards. Callers never close fonts
+// they get from here. The registry also owns TTF_Init/TTF_Quit: init() is
+// called once at startup and shutdown() closes every font before quitting.
+//
+// It also keeps one glyph atlas per font, built the first time a
+// TextRenderer asks for it, so every renderer using the same font shares
+// one texture. Atlases all belong to the one renderer the game makes and
+// releaseAtlases() must run before that renderer is destroyed.
+struct GlyphAtlas;
+
+class FontManager {
+public:
+    static bool init();
+    static void shutdown();
+
+    // Shared font handle, or nullptr if the file couldn't be opened
+    static TTF_Font* get(const std::string& path, int size);
+
+    // Shared glyph atlas for a font from get(), or nullptr without a font
+    static const GlyphAtlas* getAtlas(SDL_Renderer* renderer, TTF_Font* font);
+
+    // Atlases built so far
+    static int getAtlasCount() { return int(atlases().size()); }
+
+    // Free every atlas texture (before the renderer goes)
+    static void releaseAtlases();
+
+private:
+    typedef std::pair<std::string, int> FontKey;
+    static std::map<FontKey, TTF_Font*>& fonts();
+    static std::map<TTF_Font*, GlyphAtlas*>& atlases();
+    static bool initialized;
+};
@@ -0,0 +1,55 @@
+#pragma once
+#include <SDL.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "RenderList.h"
+
+// Builds the next frame while the current one is drawn.
+// runFrame() hands `build` (tick the game, then draw it) to a worker
+// thread that records its draw calls into one RenderList, while the
+// calling thread replays the list built last time and presents it. When
+// both are done the lists swap. So a slow present or a vsync wait overlaps
+// with the next simulation step instead of delaying it.
+//
+// The renderer is only used by the calling thread: SDL wants rendering and
+// event handling on the thread that made the window, so it's the
+// simulation that moves to the worker. `build` must not create or destroy
+// textures; do that between runFrame() calls, and keep a texture alive
+// until the frame that used it has been presented (one more runFrame).
+class FramePipeline {
+public:
+    FramePipeline();
+    ~FramePipeline();
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    void runFrame(SDL_Renderer* renderer, const std::function<void()>& build);
+
+    // Drop the built frame that hasn't been drawn yet (after a reset, or
+    // before destroying textures it uses)
+    void discard() { lists[front].reset(); }
+
+    // Time the last runFrame() spent replaying and presenting, in ms
+    double getReplayMs() const { return replayMs; }
+    double getPresentMs() const { return presentMs; }
+
+    // The frame that runFrame() will draw next
+    const RenderList& getPendingFrame() const { return lists[front]; }
+
+private:
+    void workerLoop();
+
+    RenderList lists[2];
+    int front;           // Built last frame, drawn in the next runFrame()
+    double replayMs;
+    double presentMs;
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+    const std::function<void()>* job;   // Set while the worker has a frame to build
+    bool stopping;
+};
@@ -1,16 +1,21 @@
 #pragma once
 #include <SDL.h>
 #include <SDL_mixer.h>
+#include <functional>
+#include <string>
 #include <vector>
 
-#include "Level.h"
-#include "Submarine.h"
+#include "Simulation.h"
+#include "LevelRenderer.h"
+#include "AssetLoader.h"
 #include "Scoreboard.h"
 #include "Messages.h"
 #include "Menu.hpp"
 #include "StoryManager.h"
 #include "VictoryScreen.h"
 #include "GameOverScreen.h"
+#include "PerfHud.h"
+#include "InputRecording.h"
 
 
 class GameManager {
@@ -22,11 +27,32 @@ public:
     void run();
     bool isRunning() const { return running; }
 
+    // Save this session's inputs to `path` when the game ends (--record)
+    void recordTo(const std::string& path);
+    // Play a recorded session back instead of reading the keyboard (--replay)
+    bool replayFrom(const std::string& path);
+    // Let the Autopilot bot play, restarting after every game, and log soak
+    // stats every minute (--autopilot). `uncapped` runs one tick per frame
+    // with no vsync, as fast as the machine goes (--uncapped).
+    void setAutopilot(bool uncapped);
+
 private:
+    std::string runScreen(InputRecording::Screen screen, const std::function<std::string()>& show);
+    void stopReplay();
+
     SDL_Window* window;
     SDL_Renderer* renderer;
-    Level* level;
-    Submarine* submarine;
+    Simulation* sim;               // Headless game simulation (levels, submarine, score, lives)
+    SpriteAtlas* spriteAtlas;      // Every gameplay sprite in one texture
+    LevelRenderer* levelRenderer;  // Draws the simulation state
+    TextRenderer* introText;       // Level 4 intro overlay
+    AssetLoader* assetLoader;      // Decodes level backgrounds off the main thread
+    PerfHud* perfHud;              // F3 overlay: frame times, draw calls, entity counts
+    InputRecording* recording;     // Inputs being recorded (--record), or nullptr
+    InputRecording* replay;        // Inputs being played back (--replay), or nullptr
+    std::string recordPath;
+    bool autopilot;
+    bool uncapped;
     Scoreboard* scoreboard;
     Messages* messages;
     Messages* msgManager;   // Story/message system
@@ -34,17 +60,16 @@ private:
     Menu* menu;
     bool running;
     bool startGame;
+    // All from AssetCache: released when the game ends, not freed
+    SDL_Texture* ocean;            // Current level's background
+    SDL_Texture* retiredOcean;     // Old background, still used by the frame waiting to be drawn
+    SDL_Texture* pauseBG;
+    SDL_Texture* gameOverBG;
     Mix_Music* backgroundMusic;
     Mix_Chunk* timerSound;
     Mix_Chunk* levelCompleteSound;
     Mix_Chunk* animalCollisionSound;
     Mix_Chunk* victorySound;
-    
-    // Level 4 intro sequence
-    bool showingLevel4Intro;
-    int level4IntroTimer;
-    int level4IntroBlinkCounter;
-    bool timerMusicPlayed; 
 
     std::vector<std::string> facts;   // Fact strings used in pause + game over
 };
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include "TextRenderer.h"
 
 
 class GameOverScreen {
@@ -19,6 +20,8 @@ private:
     SDL_Renderer* renderer;
     TTF_Font* fontLarge;
     TTF_Font* fontSmall;
+    TextRenderer* largeText;
+    TextRenderer* smallText;
     SDL_Texture* background = nullptr;
 
     struct Button {
@@ -0,0 +1,37 @@
+#pragma once
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+// Every printable ASCII glyph of one font, rasterized once (white) into a
+// single texture. Built and owned by FontManager, one per font, and shared
+// by every TextRenderer drawing with that font.
+struct GlyphAtlas {
+    static const int FIRST_GLYPH = 32;   // ' '
+    static const int LAST_GLYPH = 126;   // '~'
+    static const int WIDTH = 512;
+
+    struct Glyph {
+        SDL_Rect src;     // Location in the atlas
+        int advance;      // Pen movement after this glyph
+    };
+
+    GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font);
+    ~GlyphAtlas();
+
+    // nullptr for characters that aren't in the atlas
+    const Glyph* getGlyph(char c) const {
+        int code = static_cast<unsigned char>(c);
+        if (code < FIRST_GLYPH || code > LAST_GLYPH) return nullptr;
+        return &glyphs[code - FIRST_GLYPH];
+    }
+
+    SDL_Texture* texture;
+    int height;
+    int fontHeight;
+    int lineSkip;
+    Glyph glyphs[LAST_GLYPH - FIRST_GLYPH + 1];
+
+private:
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+};
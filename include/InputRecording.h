@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "SimTypes.h"
+
+// A game session as the inputs that drove it: the simulation seed, the
+// SimInput of every simulation tick and the choice made on every menu
+// screen in between (ESC pause menu, V victory shortcut, game over and
+// victory screens). The simulation only depends on these, so creating it
+// with the seed and feeding them back reproduces the session exactly.
+//
+// Ticks are run-length encoded (players hold keys for many ticks), so a
+// few minutes of play is a few KB on disk.
+class InputRecording {
+public:
+    enum Screen : uint8_t {
+        SCREEN_PAUSE = 1,      // ESC
+        SCREEN_VICTORY_KEY,    // V (demo shortcut)
+        SCREEN_GAME_OVER,
+        SCREEN_VICTORY
+    };
+
+    enum Choice : uint8_t {
+        CHOICE_RESUME = 0,
+        CHOICE_RESTART,
+        CHOICE_MENU,
+        CHOICE_EXIT
+    };
+
+    InputRecording(uint32_t seed = 0);
+
+    uint32_t getSeed() const { return seed; }
+    int getTickCount() const { return tickCount; }
+
+    // Recording
+    void addTick(const SimInput& input);
+    void addScreen(Screen screen, Choice choice);
+
+    // Playback, in recorded order
+    void rewind();
+    bool atEnd() const { return cursor >= (int)entries.size(); }
+    bool nextIsTick() const;
+    SimInput takeTick();   // Only valid when nextIsTick()
+
+    // Consume the next entry if it is `screen`; false otherwise
+    bool takeScreen(Screen screen, Choice& choice);
+    bool nextIsScreen(Screen screen) const;
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    // File for the n-th game (from 1) of a --record session. Every trip
+    // back to the menu is a new game with its own seed, so each gets its
+    // own file: the first keeps `path`, later ones are numbered before the
+    // extension (run.tsr, run-2.tsr, run-3.tsr, ...).
+    static std::string pathForGame(const std::string& path, int game);
+
+    static uint8_t packInput(const SimInput& input);
+    static SimInput unpackInput(uint8_t bits);
+
+private:
+    struct Entry {
+        bool isTick;
+        uint8_t value;    // Input bits, or screen << 4 | choice
+        int count;        // Ticks in this run (1 for screens)
+    };
+
+    uint32_t seed;
+    std::vector<Entry> entries;
+    int tickCount;
+
+    // Playback position
+    int cursor;
+    int usedInRun;
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool for splitting one loop across cores.
+//
+// parallelFor() cuts [0, count) into chunks of `grain` items and deals
+// them out to every thread's own queue (the calling thread works too).
+// Each thread takes its chunks from the front of its queue; one that runs
+// dry steals from the back of the others, so uneven chunks still finish
+// together. It returns once every chunk is done.
+//
+// Which thread runs a chunk changes from run to run, the chunks don't:
+// chunk c is always [c * grain, min(count, (c + 1) * grain)). Anything
+// order-dependent (events, random draws, removals) should be written to a
+// per-chunk slot and merged in chunk order afterwards, which gives the
+// same result as a plain loop. See Level for how the levels do it.
+class JobPool {
+public:
+    // (chunk index, begin, end)
+    using RangeFn = std::function<void(int, int, int)>;
+
+    // threadCount counts the calling thread; 0 means one per hardware thread
+    explicit JobPool(int threadCount = 0);
+    ~JobPool();
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    int getThreadCount() const { return queueCount; }
+
+    // Run body over [0, count) in chunks of `grain`. Not reentrant: call it
+    // from one thread at a time, and not from inside a body.
+    void parallelFor(int count, int grain, const RangeFn& body);
+
+    static int chunkCount(int count, int grain) {
+        if (count <= 0) return 0;
+        if (grain < 1) grain = 1;
+        return (count + grain - 1) / grain;
+    }
+
+    // Chunks taken from another thread's queue so far
+    long long getStealCount() const { return steals.load(std::memory_order_relaxed); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<int> chunks;
+    };
+
+    // Run one chunk from our queue or someone else's; false if all are empty
+    bool runOne(int self);
+    void workerLoop(int self);
+
+    Queue* queues;       // One per thread, [0] is the caller's
+    int queueCount;
+    std::vector<std::thread> workers;
+
+    // The loop being run (set before its chunks are queued)
+    const RangeFn* body;
+    int count;
+    int grain;
+    std::atomic<int> remaining;   // Chunks not finished yet
+    std::atomic<long long> steals;
+
+    std::mutex mutex;
+    std::condition_variable workReady;
+    std::condition_variable allDone;
+    unsigned generation;   // Bumped for every parallelFor
+    bool stopping;
+};
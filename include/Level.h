@@ -1,54 +1,128 @@
 #pragma once
-#include <SDL.h>
-#include <SDL_mixer.h>
 #include <vector>
+#include "SimTypes.h"
 #include "Litter.h"
 #include "Enemies.h"
 #include "Submarine.h"
-#include "Scoreboard.h"
+#include "World.h"
+#include "EntityStore.h"
+#include "SpatialGrid.h"
+#include "JobPool.h"
+#include "Rng.h"
 
 // Base Level class
+// Levels only simulate; score and lives changes are appended to the
+// event list passed to update() and drawing is done by LevelRenderer.
+// All randomness comes from the level's own generators, seeded from
+// `seed`, so the same seed and inputs always play out the same way.
+//
+// Level holds the state every level has and the update kernels they're
+// built from. The playable levels are PolicyLevel<...> (below), which
+// picks the kernels a level runs at compile time; Level1-4 are aliases
+// for the four combinations the game uses. Nothing here is virtual: code
+// that only has a Level& asks hasBlackout()/hasStorm() instead of
+// casting, and Simulation calls update() on the concrete type.
+//
+// The litter and animals live in a World. A level has one of its own, but
+// Simulation points all its levels at one shared World, so a level change
+// just starts the next level's rules on the same entities (enter()).
+// reset(seed) puts a level back to how it started, reusing its storage:
+// Simulation keeps one of each level instead of making new ones.
+//
+// The per-entity passes can be split across a JobPool (setJobPool).
+// Whatever depends on order (random draws, events, removals) is collected
+// per chunk and applied afterwards in entity order, so a pool never
+// changes the outcome.
 class Level {
 public:
-    Level(SDL_Renderer* renderer,
-          const std::vector<SDL_Texture*>& litterTextures,
-          const std::vector<SDL_Texture*>& enemyTextures,
-          const std::vector<float>& enemySpeeds,
-          const std::vector<int>& enemyWidths,
-          const std::vector<int>& enemyHeights);
-    virtual ~Level();
-
-    virtual void update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bool& gameOver);
-    virtual void render();
-    virtual void renderBlackoutEffects(Submarine& submarine);
-    virtual void reset();
-    void setOilTexture(SDL_Texture* oilTex);
-    void setAnimalCollisionSound(Mix_Chunk* sound) { animalCollisionSound = sound; }
+    static constexpr int DEFAULT_JOB_GRAIN = 256;   // Entities per chunk
+
+    // Level 4 litter lives in litterFlow, a fixed pool: storage is reserved
+    // once and litter that leaves the screen or gets collected is swapped
+    // out, so it only ever holds live litter. ~75 pieces are on screen at
+    // once, so this never fills up in practice.
+    static constexpr int LITTER_POOL_SIZE = 128;
+
+    Level(const Level&) = delete;
+    Level& operator=(const Level&) = delete;
+
+    // Work on `world` from now on (nullptr: the level's own)
+    void setWorld(World* world);
+
+    // Run the entity passes on `pool` (nullptr: on the calling thread).
+    // Only lists longer than `grain` actually get shared out.
+    void setJobPool(JobPool* pool, int grain = DEFAULT_JOB_GRAIN);
+
+    // Back to the state the constructor leaves it in, as if just made
+    // with `seed`: empties the world and puts the starting litter in.
+    // Keeps the job pool and the memory already allocated.
+    void reset(uint64_t seed);
+
+    // Take over the world as the previous level left it. The level's own
+    // state (timers, blackout, ink, storm) starts over from `seed`, the
+    // litter and animals carry on.
+    void enter(uint64_t seed);
+
+    // What this level does, fixed by its type
+    bool hasBlackout() const { return features.blackout; }   // Oil blackout and ink (Level 3)
+    bool hasStorm() const { return features.storm; }         // Storm timer and litter flow (Level 4)
+
     void calmEnemies(float subX, float subY, float radius);
-    std::vector<Litter>& getLitterItems() { return litterItems; }
-    void setLitterItems(const std::vector<Litter>& litter) { litterItems = litter; }
-    std::vector<Enemies>& getEnemyItems() { return enemyItems; }
-    void setEnemyItems(const std::vector<Enemies>& enemies) { enemyItems = enemies; }
+    std::vector<Litter>& getLitterItems() { return world->litter; }
+    const std::vector<Litter>& getLitterItems() const { return world->litter; }
+    void setLitterItems(const std::vector<Litter>& litter) { world->litter = litter; }
+    // (handing the animals out for changing means the grid is rebuilt first)
+    std::vector<Enemies>& getEnemyItems() { enemyGridValid = false; return world->enemies; }
+    const std::vector<Enemies>& getEnemyItems() const { return world->enemies; }
+    void setEnemyItems(const std::vector<Enemies>& enemies) { world->enemies = enemies; enemyGridValid = false; }
+    // Level 4's dense litter flow (empty on the other levels)
+    const EntityStore& getLitterFlow() const { return litterFlow; }
     bool isInBlackout() const { return isBlackout; }
     bool isOilWarning() const { return isWarning; }
 
+    // Blackout state read by the renderer (all off without hasBlackout())
+    struct OilSpot { int x, y, size; int spawnFrame; float alpha; };
+    const std::vector<OilSpot>& getOilSpots() const { return oilSpots; }
+    bool isBlackoutFadingOut() const { return isBlackoutFading; }
+    int getBlackoutWidth() const { return blackoutWidth; }
+    int getBlackoutCounter() const { return blackoutCounter; }
+    bool isPositionInBlackout(int x, int y) const;
+
+    // Wavy blackout edge: horizontal offset for each screen row (600),
+    // worked out once per tick and shared with the renderer
+    const std::vector<int>& getBlackoutWaves() const { return blackoutWaves; }
+
+    // Storm state (0 without hasStorm())
+    int getStormTimer() const { return stormTimer; }
+    float getScrollOffset() const { return scrollOffset; }
+    int getCameraShake() const { return cameraShakeFrames; }
 
 protected:
-    SDL_Renderer* renderer;
-    std::vector<Litter> litterItems;
-    std::vector<Enemies> enemyItems;
-    std::vector<SDL_Texture*> enemyTextures;
-    Mix_Chunk* animalCollisionSound;
+    // Chosen by PolicyLevel from its policies
+    struct Features {
+        bool startingLitter;   // reset() puts the seven starting pieces in
+        bool blackout;
+        bool storm;
+    };
+
+    // Doesn't reset(); PolicyLevel does once it has set the level up
+    Level(const SimConfig& config, const Features& features);
+
+    Features features;
+    World ownWorld;   // Used until setWorld() says otherwise
+    World* world;     // Litter and animals being simulated
+    EntityStore litterFlow;
+    std::vector<int> litterWidths;
+    std::vector<int> litterHeights;
     std::vector<float> enemySpeeds;
     std::vector<int> enemyWidths;
     std::vector<int> enemyHeights;
+    std::vector<int> spawnableEnemies;   // Enemy types this level spawns
     int spawnTimer;
     int spawnInterval;
     int maxActiveEnemies;
     
     // Oil blackout system (for Level 3)
-    SDL_Texture* oilTexture;
-    struct OilSpot { int x, y, size; int spawnFrame; float alpha; };
     std::vector<OilSpot> oilSpots;
     int blackoutNext;
     int warningFrameCounter;
@@ -62,83 +136,198 @@ protected:
     bool isBlackoutFading;
     bool isBlackoutFullyCovered;
     int fullCoverCounter;
-    
-    virtual void updateEnemies(Submarine& submarine, int& lives, bool& gameOver);
-    virtual void updateBlackoutMechanic();
-};
+    std::vector<int> blackoutWaves;   // 600 rows with a blackout, else empty
 
-// Level 1: Only litter, no animals
-class Level1 : public Level {
-public:
-    Level1(SDL_Renderer* renderer,
-           const std::vector<SDL_Texture*>& litterTextures,
-           const std::vector<SDL_Texture*>& enemyTextures,
-           const std::vector<float>& enemySpeeds,
-           const std::vector<int>& enemyWidths,
-           const std::vector<int>& enemyHeights);
-    
-    void update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bool& gameOver) override;
+    // Superstorm (for Level 4)
+    std::vector<int> scaledWidths;    // Flow litter sizes
+    std::vector<int> scaledHeights;
+    int stormFrames;          // Length of the storm (from the config)
+    int stormTimer;           // Countdown timer in frames (60 fps)
+    float scrollOffset;       // Auto-scroll position
+    int cameraShakeFrames;    // Frames of camera shake remaining
+    int litterSpawnTimer;     // Timer for spawning new litter from the right
+
+    // Broadphase for submarine pickups/hits and the calm radius, kept up
+    // to date in place (only entities that changed cells are moved).
+    // The litter grid holds the classic litter or, in Level 4, the flow.
+    SpatialGrid litterGrid;
+    SpatialGrid enemyGrid;
+    int litterGridCount;      // Ids [0, count) may be in the grid
+    int enemyGridCount;
+    bool enemyGridValid;      // Matches the enemies' positions right now
+    std::vector<int> gridHits;
+
+    // Independent random streams (same seed, different stream ids), so
+    // e.g. more ink this tick doesn't change where the next animal appears
+    enum RngStream { STREAM_ENEMY_SPAWN = 1, STREAM_LITTER_SPAWN, STREAM_LITTER_RESPAWN, STREAM_INK };
+    Rng enemyRng;      // Which animal spawns and where
+    Rng litterRng;     // Where litter starts (level start, reset, Level 4 flow)
+    Rng respawnRng;    // Where wrapped/collected litter comes back
+    Rng inkRng;        // Octopus ink spots
+
+    // Only keep the types the config has sizes and speeds for
+    void setSpawnableEnemies(const std::vector<int>& types);
+    // The litter a level starts with after reset()
+    void placeStartingLitter();
+    int pickEnemyType() { return enemyRng.pick(spawnableEnemies); }
+
+    //  Update kernels, run by PolicyLevel::update in this order 
+
+    // Storm countdown
+    void updateStormTimer() { if (stormTimer > 0) stormTimer--; }
+
+    // Move litter; wrapped/respawned litter gets its new height in order
+    void updateLitter(std::vector<SimEvent>& events);
+    // Collect active litter touching the submarine
+    void collectLitter(Submarine& submarine, std::vector<SimEvent>& events);
+    // Level 4: feed litter in from the right, drift it, collect it
+    void updateLitterFlow(Submarine& submarine, std::vector<SimEvent>& events);
+
+    // Count down to the next animal. True when one should spawn now
+    // (there's room on screen and something to spawn).
+    bool enemySpawnDue();
+    void spawnEnemy(int type, float x, float y, float speed) {
+        world->enemies.emplace_back(SPRITE_SWORDFISH + type, x, y, speed,
+                                    enemyWidths[type], enemyHeights[type], type);
+    }
+    // Update the animals, dropping any that were already off screen
+    // (octopusExitsTop: octopuses leave through the top, not the left).
+    // Brings the enemy grid up to date afterwards.
+    void moveEnemies(const Submarine& submarine, bool octopusExitsTop);
+    // Hit the submarine with any (non-falling) enemy touching it
+    // (uses the grid moveEnemies left)
+    void hitEnemies(Submarine& submarine, std::vector<SimEvent>& events);
+
+    // Put the grids in step with the entities
+    void syncLitterGrid();
+    void syncFlowGrid();
+    void syncEnemyGrid();
+
+    // Warning, spread, hold and fade of the oil blackout
+    void updateBlackout();
+    // Octopuses squirt ink spots; spots fade in, linger and fade out
+    void updateInk();
+
+    // Run body over [0, count) in chunks, on the pool if there is one.
+    // Returns the number of chunks; chunkResults has an empty slot for each.
+    int forEachChunk(int count, const JobPool::RangeFn& body);
+
+    JobPool* jobPool;
+    int jobGrain;
+    std::vector<std::vector<std::pair<int, int>>> chunkResults;  // (index, value) per chunk
+    std::vector<uint8_t> removeFlags;                            // One per entity, set = drop it
+
+private:
+    int waveOffsetAt(int y) const;
+    void updateBlackoutWaves();
 };
 
-// Level 2: Litter + Animals
-class Level2 : public Level {
-public:
-    Level2(SDL_Renderer* renderer,
-           const std::vector<SDL_Texture*>& litterTextures,
-           const std::vector<SDL_Texture*>& enemyTextures,
-           const std::vector<float>& enemySpeeds,
-           const std::vector<int>& enemyWidths,
-           const std::vector<int>& enemyHeights);
-    
-    void updateEnemies(Submarine& submarine, int& lives, bool& gameOver) override;
+//  Level policies 
+// Each one is a tag type PolicyLevel reads at compile time.
+
+// Litter: the seven pieces that float and wrap around (levels 1-3)...
+struct FloatingLitter {
+    static constexpr bool STARTING_LITTER = true;
+    static constexpr bool FLOW = false;
+};
+// ...or the storm's constant flow from the right, starting from open water
+struct StormLitterFlow {
+    static constexpr bool STARTING_LITTER = false;
+    static constexpr bool FLOW = true;
 };
 
-// Level 3: Litter + Animals + Oil blackout mechanics
-class Level3 : public Level {
-public:
-    Level3(SDL_Renderer* renderer,
-           const std::vector<SDL_Texture*>& litterTextures,
-           const std::vector<SDL_Texture*>& enemyTextures,
-           const std::vector<float>& enemySpeeds,
-           const std::vector<int>& enemyWidths,
-           const std::vector<int>& enemyHeights);
-    
-    void update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bool& gameOver) override;
-    void renderBlackoutEffects(Submarine& submarine) override;
-    bool isPositionInBlackout(int x, int y);
+// Animals: none...
+struct NoAnimals {
+    static constexpr bool SPAWNS = false;
+    static std::vector<int> types() { return {}; }
 };
+// ...or the listed types, spawned on the right (octopuses from below if
+// OctopusFromBelow, leaving through the top) at SpeedScale x their speed
+template <bool OctopusFromBelow, int SpeedScale, int... Types>
+struct Animals {
+    static constexpr bool SPAWNS = true;
+    static constexpr bool OCTOPUS_FROM_BELOW = OctopusFromBelow;
+    static constexpr float SPEED_SCALE = float(SpeedScale);
+    static std::vector<int> types() { return { Types... }; }
+};
+
+// Oil blackout and octopus ink
+struct NoBlackout { static constexpr bool ENABLED = false; };
+struct OilBlackout { static constexpr bool ENABLED = true; };
 
-// Level 4: Superstorm Surge - Final level with timer and intense mechanics
-class Level4 : public Level3 {
+// Storm timer (the level is won when it runs out)
+struct NoStorm { static constexpr bool ENABLED = false; };
+struct Superstorm { static constexpr bool ENABLED = true; };
+
+// A level made of one policy of each kind. update() only contains the
+// kernels the policies ask for, so it's one straight, inlinable function
+// per level type.
+template <class LitterPolicy, class AnimalPolicy, class BlackoutPolicy, class StormPolicy>
+class PolicyLevel : public Level {
 public:
-    Level4(SDL_Renderer* renderer,
-           const std::vector<SDL_Texture*>& litterTextures,
-           const std::vector<SDL_Texture*>& enemyTextures,
-           const std::vector<float>& enemySpeeds,
-           const std::vector<int>& enemyWidths,
-           const std::vector<int>& enemyHeights);
-    
-    void update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bool& gameOver) override;
-    void updateBlackoutMechanic() override;  // Disable ink mechanics in Level 4
-    void updateEnemies(Submarine& submarine, int& lives, bool& gameOver) override;  // Exclude octopuses and sharks
-    void renderBlackoutEffects(Submarine& submarine) override;
-    void render() override;
-    int getStormTimer() const { return stormTimer; }
-    float getScrollOffset() const { return scrollOffset; }
-    int getCameraShake() const { return cameraShakeFrames; }
-    std::vector<int> scaledWidths;
-    std::vector<int> scaledHeights;
+    static constexpr bool HAS_ANIMALS = AnimalPolicy::SPAWNS;
+    static constexpr bool HAS_BLACKOUT = BlackoutPolicy::ENABLED;
+    static constexpr bool HAS_STORM = StormPolicy::ENABLED;
 
+    PolicyLevel(const SimConfig& config, uint64_t seed = Rng::DEFAULT_SEED)
+        : Level(config, { LitterPolicy::STARTING_LITTER, HAS_BLACKOUT, HAS_STORM })
+    {
+        setSpawnableEnemies(AnimalPolicy::types());
+        if (HAS_BLACKOUT) blackoutWaves.assign(600, 0);
+        if (HAS_STORM) {
+            // More enemies for increased challenge in final level
+            maxActiveEnemies = config.stormMaxActiveEnemies;  // 4 enemies on screen
+            spawnInterval = config.stormSpawnInterval;        // spawns every 2 seconds
+        }
+        if (LitterPolicy::FLOW) litterFlow.reserve(LITTER_POOL_SIZE);
+        reset(seed);
+    }
 
-private:
-    int stormTimer;           // Countdown timer in frames (60 fps)
-    int stormPulseCounter;    // For periodic storm pulses
-    float litterSpeedMultiplier;  // Increases litter speed
-    float scrollOffset;       // Auto-scroll position
-    float scrollSpeed;        // Speed of forced scrolling
-    int cameraShakeFrames;    // Frames of camera shake remaining
-    int distanceTraveled;     // Distance traveled (for pressure)
-    int clusterSpawnTimer;    // Timer for spawning new clusters
-    int litterSpawnTimer;     // Timer for spawning new litter from the right
-    std::vector<SDL_Texture*> storedLitterTextures;  // Store textures for spawning
+    void update(Submarine& submarine, std::vector<SimEvent>& events) {
+        if constexpr (HAS_STORM) updateStormTimer();
+
+        if constexpr (LitterPolicy::FLOW) {
+            updateLitterFlow(submarine, events);
+        } else {
+            updateLitter(events);
+            collectLitter(submarine, events);
+        }
+
+        if constexpr (HAS_ANIMALS) updateEnemies(submarine, events);
+
+        if constexpr (HAS_BLACKOUT) {
+            updateBlackout();
+            updateInk();
+        }
+    }
+
+    // Spawn, move and hit with the animals
+    void updateEnemies(Submarine& submarine, std::vector<SimEvent>& events) {
+        static_assert(HAS_ANIMALS, "this level has no animals");
+        if (enemySpawnDue()) {
+            int type = pickEnemyType();
+            if (AnimalPolicy::OCTOPUS_FROM_BELOW && type == 2) {
+                float startX = enemyRng.range(50, 750);  // Random X position across screen
+                spawnEnemy(type, startX, 600, enemySpeeds[type] * AnimalPolicy::SPEED_SCALE);
+            } else {
+                float startY = enemyRng.range(50, 550);  // Random Y position, from the right
+                spawnEnemy(type, 850, startY, enemySpeeds[type] * AnimalPolicy::SPEED_SCALE);
+            }
+        }
+        moveEnemies(submarine, AnimalPolicy::OCTOPUS_FROM_BELOW);
+        hitEnemies(submarine, events);
+    }
 };
+
+// Level 1: Only litter, no animals
+using Level1 = PolicyLevel<FloatingLitter, NoAnimals, NoBlackout, NoStorm>;
+
+// Level 2: Litter + Animals (no octopus yet)
+using Level2 = PolicyLevel<FloatingLitter, Animals<false, 1, 0, 1, 3, 4>, NoBlackout, NoStorm>;
+
+// Level 3: Litter + Animals + Oil blackout mechanics
+using Level3 = PolicyLevel<FloatingLitter, Animals<true, 1, 0, 1, 2, 3, 4>, OilBlackout, NoStorm>;
+
+// Level 4: Superstorm Surge - timer, litter flow and fast animals
+// (no octopus or shark in the storm)
+using Level4 = PolicyLevel<StormLitterFlow, Animals<false, 3, 0, 1, 3>, NoBlackout, Superstorm>;
@@ -0,0 +1,42 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "Level.h"
+#include "Submarine.h"
+#include "TextRenderer.h"
+#include "SpriteAtlas.h"
+#include "SpriteBatch.h"
+
+// Draws simulation state. Entities only carry sprite IDs; this class looks
+// them up in the sprite atlas and queues them in a SpriteBatch, so each
+// layer (litter + enemies, submarine, ink spots, hearts) is one draw call.
+class LevelRenderer {
+public:
+    LevelRenderer(SDL_Renderer* renderer, const SpriteAtlas& atlas);
+    ~LevelRenderer();
+
+    // Litter and enemies
+    void render(const Level& level);
+    void renderSubmarine(const Submarine& submarine);
+    void renderHearts(int lives);
+
+    // Level 3 ink spots/blackout overlay, Level 4 storm timer
+    void renderBlackoutEffects(const Level& level, const Submarine& submarine);
+
+private:
+    void queueLitter(const Litter& litter);
+    void queueEnemy(const Enemies& enemy);
+    void queueSprite(int sprite, SpriteAtlas::Variant variant, const SDL_Rect& dest,
+                     SDL_Color color = SDL_Color{ 255, 255, 255, 255 });
+    void renderInkAndBlackout(const Level& level, const Submarine& submarine);
+    void renderStormTimer(const Level& level);
+
+    SDL_Renderer* renderer;
+    const SpriteAtlas& atlas;
+    SpriteBatch batch;
+    TextRenderer* timerText;  // Level 4 storm timer
+
+    // Blackout overlay mesh, reused every frame
+    std::vector<SDL_Vertex> blackoutVertices;
+    std::vector<int> blackoutIndices;
+};
@@ -1,35 +1,42 @@
 #pragma once
-#include <SDL.h>
-#include <SDL_image.h>
+#include "SimTypes.h"
+#include "Rng.h"
 
 class Litter {
 public:
-    SDL_Texture* texture;  // Texture for the litter
+    int sprite;            // Sprite ID used by the renderer
     float x, y;            // Position
     float speed;           // Movement speed toward the left
     bool active;           // Whether it's visible / collectible
     int respawnTimer;      // Countdown before reappearing
 
-    Litter(SDL_Texture* tex, float startX, float startY, float moveSpeed)
-    : Litter(tex, startX, startY, moveSpeed, 40, 40) {}
+    Litter(int sprite, float startX, float startY, float moveSpeed)
+    : Litter(sprite, startX, startY, moveSpeed, 40, 40) {}
 
 
     // Constructor
-    Litter(SDL_Texture* tex, float startX, float startY, float moveSpeed, int w, int h);
+    Litter(int sprite, float startX, float startY, float moveSpeed, int w, int h);
 
-    // Update movement + respawn logic
+    // Update movement + respawn logic (rng picks the height it comes back at)
     // Returns true if this litter went off the left edge (missed) and wrapped
-    bool update();
+    bool update(Rng& rng);
 
-    // Draw litter if active
-    void render(SDL_Renderer* renderer);
+    // update() in two halves, so the moving can run in parallel while the
+    // random heights are still drawn in litter order: advance() moves or
+    // counts down, and if it says so, respawn() picks the new height.
+    enum Step { STEP_NONE, STEP_RESPAWNED, STEP_WRAPPED };
+    Step advance();
+    void respawn(Rng& rng);
 
     // Check collision with submarine
-    bool checkCollision(const SDL_Rect& subRect);
+    bool checkCollision(const SimRect& subRect);
 
     // When collected → deactivate + start respawn timer
     void collect();
 
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
     private:
 
     int width;
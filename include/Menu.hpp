@@ -7,6 +7,7 @@
 #include <vector>
 #include <iostream>
 #include "ChatUI.h"
+#include "TextRenderer.h"
 
 class Menu {
 public:
@@ -26,6 +27,13 @@ private:
     TTF_Font* font;
     TTF_Font* titleFont;
     TTF_Font* chatFont;
+    TTF_Font* instructionsFont;
+
+    // Glyph atlases for the fonts above
+    TextRenderer* itemText;
+    TextRenderer* titleText;
+    TextRenderer* chatText;
+    TextRenderer* instructionsText;
     SDL_Texture* menuBackgroundTexture;
     SDL_Texture* instructionsBackgroundTexture;
     Mix_Music* menuMusic;
@@ -70,7 +78,7 @@ private:
 
 
     // Safe text renderer used ONLY for radio screens
-    SDL_Texture* renderText(const std::string& msg, SDL_Color color, SDL_Rect& dst, bool wrap = false);
+    void renderText(const std::string& msg, SDL_Color color, SDL_Rect& dst, bool wrap = false);
     SDL_Texture* chatBGTexture = nullptr;
 
 };
\ No newline at end of file
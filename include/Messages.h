@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include <queue>
+#include "TextRenderer.h"
 
 enum class MessageStyle {
     RADIO,
@@ -47,11 +48,11 @@ public:
 
 
 private:
-    SDL_Texture* createTexture(const std::string& text);
     void startTypewriter(const std::string& text);
 
     SDL_Renderer* renderer;
     TTF_Font* font;
+    TextRenderer* textRenderer;
 
     MessageStyle style = MessageStyle::RADIO;
 
@@ -75,7 +76,7 @@ private:
 
     // Cutscene 
     std::vector<std::string> messageList;
-    SDL_Texture* currentMessage = nullptr;
+    std::string currentMessage;
     int currentIndex = -1;
 
     float alpha = 0;
@@ -0,0 +1,44 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "Level.h"
+#include "TextRenderer.h"
+
+// Performance overlay, toggled with F3.
+// Shows FPS, a rolling frame-time graph with p50/p99, how the frame split
+// between simulation and rendering, last frame's draw calls (from
+// RenderStats), live entity counts and texture memory. The 16.7 ms line on
+// the graph is the 60 fps budget.
+class PerfHud {
+public:
+    static constexpr int HISTORY = 120;   // Frames in the graph (2 s at 60 fps)
+
+    PerfHud(SDL_Renderer* renderer);
+    ~PerfHud();
+
+    void toggle() { visible = !visible; }
+    bool isVisible() const { return visible; }
+
+    // Timings for the frame that just finished, in milliseconds
+    void recordFrame(double frameMs, double simMs, double renderMs);
+
+    void render(const Level& level);
+
+    // p-th percentile (0-100) of the recorded frame times
+    double frameTimePercentile(double p) const;
+
+private:
+    SDL_Renderer* renderer;
+    TextRenderer* text;
+    bool visible;
+
+    std::vector<float> frameTimes;   // Ring buffer of HISTORY samples
+    int nextSample;
+    int sampleCount;
+    double lastSimMs, lastRenderMs;
+
+    // Scratch space, reused every frame
+    mutable std::vector<float> sorted;
+    std::vector<SDL_Vertex> graphVertices;
+    std::vector<int> graphIndices;
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Scoped-zone frame profiler.
+//
+//   PROFILE_ZONE("Render");        // times the enclosing scope
+//   PROFILE_FUNCTION();            // same, named after the function
+//   PROFILE_THREAD_NAME("Loader"); // label for the calling thread
+//
+// Every thread records into its own fixed-size ring buffer (the oldest zones
+// get overwritten), so recording never allocates. Profiler::writeChromeTrace
+// dumps all buffers as Chrome trace JSON, which chrome://tracing and
+// ui.perfetto.dev open directly.
+//
+// The macros compile to nothing unless TS_PROFILING is 1. It defaults to on
+// for builds without NDEBUG (debug) and off for release; pass
+// -DTS_PROFILING=0/1 to override.
+#ifndef TS_PROFILING
+#ifdef NDEBUG
+#define TS_PROFILING 0
+#else
+#define TS_PROFILING 1
+#endif
+#endif
+
+// Where the F9 hotkey and exit dumps go (working directory)
+const char* const PROFILE_TRACE_PATH = "tidesweeper_trace.json";
+
+class Profiler {
+public:
+    static constexpr int RING_SIZE = 16384;  // Zones kept per thread
+
+    // Times one scope. Names must outlive the profiler (use string literals).
+    class Zone {
+    public:
+        explicit Zone(const char* name);
+        ~Zone();
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+    private:
+        const char* name;
+        int64_t startNs;
+    };
+
+    static void setThreadName(const char* name);
+
+    // Write every thread's recorded zones as Chrome trace JSON. Safe to call
+    // while other threads are still recording.
+    static bool writeChromeTrace(const std::string& path);
+
+    // Drop everything recorded so far
+    static void clear();
+
+    // Zones currently held for the calling thread
+    static int threadZoneCount();
+
+    // Nanoseconds since the profiler's clock started
+    static int64_t nowNs();
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if TS_PROFILING
+#define PROFILE_ZONE(name) Profiler::Zone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
+#define PROFILE_THREAD_NAME(name) Profiler::setThreadName(name)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_THREAD_NAME(name) ((void)0)
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+
+// One frame's draw calls, recorded instead of issued.
+// RenderStats appends to the list it is recording into (see
+// RenderStats::record), so drawing code doesn't know whether it's talking
+// to SDL or filling a list. replay() then issues the same calls, in the
+// same order, on whichever thread owns the renderer. Vertex and index data
+// is copied in, so the list doesn't point into anyone's scratch buffers;
+// textures are only referenced and must outlive the replay.
+class RenderList {
+public:
+    RenderList() = default;
+    RenderList(const RenderList&) = delete;
+    RenderList& operator=(const RenderList&) = delete;
+
+    // Forget everything (keeps the memory for the next frame)
+    void reset();
+    bool empty() const { return commands.empty(); }
+    int size() const { return int(commands.size()); }
+
+    void setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+    void setBlendMode(SDL_BlendMode mode);
+    void clear();
+    void copy(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dest);
+    void fillRect(const SDL_Rect* rect);
+    void drawRect(const SDL_Rect* rect);
+    void drawLine(int x1, int y1, int x2, int y2);
+    void geometry(SDL_Texture* texture, const SDL_Vertex* vertices, int numVertices,
+                  const int* indices, int numIndices);
+
+    // Issue every recorded call on `renderer` (straight to SDL, RenderStats
+    // already counted them while recording)
+    void replay(SDL_Renderer* renderer) const;
+
+private:
+    enum class Type { DrawColor, BlendMode, Clear, Copy, FillRect, DrawRect, DrawLine, Geometry };
+
+    struct Command {
+        Type type;
+        SDL_Texture* texture;
+        SDL_Rect src;           // DrawLine keeps its end points in src/dest x, y
+        SDL_Rect dest;
+        bool hasSrc, hasDest;   // nullptr rects mean the whole texture/target
+        SDL_Color color;
+        SDL_BlendMode blendMode;
+        int firstVertex, vertexCount;
+        int firstIndex, indexCount;
+    };
+
+    Command& add(Type type);
+
+    std::vector<Command> commands;
+    std::vector<SDL_Vertex> vertices;   // All Geometry commands' vertices back to back
+    std::vector<int> indices;
+};
@@ -0,0 +1,117 @@
+#pragma once
+#include <SDL.h>
+#include "RenderList.h"
+
+// Thin wrappers around the SDL draw and texture calls the game uses, so the
+// perf HUD can show how many draw calls a frame issued and how much texture
+// memory is alive. Call these instead of the SDL functions directly.
+//
+// While a RenderList is being recorded (record()), the draw calls go into
+// the list instead of to SDL and are counted there. Only one thread draws
+// or records at a time (FramePipeline hands over between them), so plain
+// counters are enough. Textures are created and destroyed on the thread
+// that owns the renderer.
+class RenderStats {
+public:
+    // Draw calls issued in one frame (value-initialize to zero: Frame())
+    struct Frame {
+        int copies;     // SDL_RenderCopy
+        int fills;      // SDL_RenderFillRect
+        int outlines;   // SDL_RenderDrawRect / SDL_RenderDrawLine
+        int geometry;   // SDL_RenderGeometry (sprite batches, text, blackout)
+
+        int total() const { return copies + fills + outlines + geometry; }
+    };
+
+    // Start counting a new frame; the finished one moves to lastFrame()
+    static void beginFrame() {
+        last = current;
+        current = Frame();
+    }
+    static const Frame& lastFrame() { return last; }
+    static const Frame& currentFrame() { return current; }
+
+    static long long getTextureBytes() { return textureBytes; }
+    static int getTextureCount() { return textureCount; }
+
+    // Send draw calls to `list` until record(nullptr)
+    static void record(RenderList* list) { recording = list; }
+
+    // Draw state (not counted as draw calls)
+    static int setDrawColor(SDL_Renderer* renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+        if (recording) { recording->setDrawColor(r, g, b, a); return 0; }
+        return SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    }
+
+    static int setBlendMode(SDL_Renderer* renderer, SDL_BlendMode mode) {
+        if (recording) { recording->setBlendMode(mode); return 0; }
+        return SDL_SetRenderDrawBlendMode(renderer, mode);
+    }
+
+    static int clear(SDL_Renderer* renderer) {
+        if (recording) { recording->clear(); return 0; }
+        return SDL_RenderClear(renderer);
+    }
+
+    static int copy(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dest) {
+        current.copies++;
+        if (recording) { recording->copy(texture, src, dest); return 0; }
+        return SDL_RenderCopy(renderer, texture, src, dest);
+    }
+
+    static int fillRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+        current.fills++;
+        if (recording) { recording->fillRect(rect); return 0; }
+        return SDL_RenderFillRect(renderer, rect);
+    }
+
+    static int drawRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+        current.outlines++;
+        if (recording) { recording->drawRect(rect); return 0; }
+        return SDL_RenderDrawRect(renderer, rect);
+    }
+
+    static int drawLine(SDL_Renderer* renderer, int x1, int y1, int x2, int y2) {
+        current.outlines++;
+        if (recording) { recording->drawLine(x1, y1, x2, y2); return 0; }
+        return SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+    }
+
+    static int geometry(SDL_Renderer* renderer, SDL_Texture* texture,
+                        const SDL_Vertex* vertices, int numVertices,
+                        const int* indices, int numIndices) {
+        current.geometry++;
+        if (recording) { recording->geometry(texture, vertices, numVertices, indices, numIndices); return 0; }
+        return SDL_RenderGeometry(renderer, texture, vertices, numVertices, indices, numIndices);
+    }
+
+    static SDL_Texture* createTexture(SDL_Renderer* renderer, SDL_Surface* surface) {
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+        if (texture) {
+            textureBytes += bytesOf(texture);
+            textureCount++;
+        }
+        return texture;
+    }
+
+    static void destroyTexture(SDL_Texture* texture) {
+        if (!texture) return;
+        textureBytes -= bytesOf(texture);
+        textureCount--;
+        SDL_DestroyTexture(texture);
+    }
+
+private:
+    static long long bytesOf(SDL_Texture* texture) {
+        Uint32 format = 0;
+        int w = 0, h = 0;
+        if (SDL_QueryTexture(texture, &format, nullptr, &w, &h) != 0) return 0;
+        return (long long)w * h * SDL_BYTESPERPIXEL(format);
+    }
+
+    static inline Frame current = Frame();
+    static inline Frame last = Frame();
+    static inline long long textureBytes = 0;
+    static inline int textureCount = 0;
+    static inline RenderList* recording = nullptr;
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Small, fast, seedable random generator (PCG32, pcg-random.org).
+// Unlike rand() it has no global state: every level owns its generators,
+// so two simulations never disturb each other and a seed reproduces a run
+// exactly. Different stream ids give independent sequences from the same
+// seed, which keeps e.g. ink spawning from shifting where litter respawns.
+class Rng {
+public:
+    static constexpr uint64_t DEFAULT_SEED = 0x853c49e6748fea9bULL;
+
+    Rng(uint64_t seed = DEFAULT_SEED, uint64_t stream = 0) { reseed(seed, stream); }
+
+    void reseed(uint64_t seed, uint64_t stream = 0) {
+        state = 0;
+        inc = (stream << 1) | 1;
+        next();
+        state += seed;
+        next();
+    }
+
+    uint32_t next() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + inc;
+        uint32_t xorshifted = uint32_t(((old >> 18) ^ old) >> 27);
+        uint32_t rot = uint32_t(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+
+    // For seeding other generators. Two statements so the high half is
+    // always drawn first (call order inside one expression is unspecified).
+    uint64_t next64() {
+        uint64_t hi = next();
+        return (hi << 32) | next();
+    }
+
+    // Uniform int in [0, n). Multiply-shift instead of %: no division, and
+    // the bias (n / 2^32) is far too small to matter for game rolls.
+    int below(int n) { return n > 0 ? int((uint64_t(next()) * uint32_t(n)) >> 32) : 0; }
+
+    // Uniform int in [lo, hi)
+    int range(int lo, int hi) { return lo + below(hi - lo); }
+
+    // True `percent`% of the time
+    bool chance(int percent) { return below(100) < percent; }
+
+    // Uniform pick from a non-empty table
+    template <typename T>
+    const T& pick(const std::vector<T>& table) { return table[below(int(table.size()))]; }
+
+private:
+    uint64_t state;
+    uint64_t inc;
+};
@@ -4,6 +4,7 @@
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include <string>
+#include "TextRenderer.h"
 
 class ScoreDisplay {
     public:
@@ -22,12 +23,13 @@ class ScoreDisplay {
         int score;
         int level;
         TTF_Font* font;
-        SDL_Texture* scoreTexture;
-        SDL_Texture* levelTexture;
+        TextRenderer* textRenderer;
+        std::string scoreText;
+        std::string levelText;
         void renderScore();
         void renderLevel();
-        void updateTextTexture();
-        void updateLevelTexture();
+        void updateScoreText();
+        void updateLevelText();
 };
 
 #endif 
\ No newline at end of file
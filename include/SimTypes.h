@@ -0,0 +1,96 @@
+#pragma once
+#include <vector>
+
+// Shared types for the headless simulation core (tidesweeper_core).
+// Nothing in here may depend on SDL so the simulation can run without
+// a window or audio device.
+
+// Axis-aligned rectangle in screen pixels (same layout as SDL_Rect)
+struct SimRect {
+    int x, y, w, h;
+};
+
+// Strict overlap test: touching edges do not count as a collision
+inline bool rectsOverlap(const SimRect& a, const SimRect& b) {
+    return (a.x < b.x + b.w &&
+            a.x + a.w > b.x &&
+            a.y < b.y + b.h &&
+            a.y + a.h > b.y);
+}
+
+// Sprite IDs referenced by simulation entities. The renderer maps each ID
+// to a texture; the simulation only needs to know which one to draw.
+enum SpriteId {
+    // Litter (order matches the original texture list)
+    SPRITE_CAN = 0,
+    SPRITE_BOTTLE,
+    SPRITE_BAG,
+    SPRITE_CUP,
+    SPRITE_COLA,
+    SPRITE_SMALLCAN,
+    SPRITE_BEER,
+
+    // Enemies (SPRITE_SWORDFISH + enemyType)
+    SPRITE_SWORDFISH,
+    SPRITE_EEL,
+    SPRITE_OCTOPUS,
+    SPRITE_ANGLER,
+    SPRITE_SHARK,
+
+    SPRITE_SUBMARINE,
+    SPRITE_HEART,
+    SPRITE_OIL,
+
+    SPRITE_COUNT
+};
+
+const int LITTER_TYPE_COUNT = 7;
+const int ENEMY_TYPE_COUNT = 5;
+
+// Entity sizes and speeds the simulation is built from. The defaults match
+// the shipped assets (litter at 0.15 scale, submarine at 0.11 scale), so a
+// headless run behaves exactly like the game. GameManager overwrites the
+// sizes with the real texture dimensions when it loads them.
+struct SimConfig {
+    std::vector<int> litterWidths  = { 37, 30, 45, 37, 30, 30, 30 };
+    std::vector<int> litterHeights = { 60, 66, 60, 52, 67, 37, 81 };
+
+    std::vector<float> enemySpeeds = { 6.0f, 6.0f, 6.0f, 6.0f, 4.0f };
+    std::vector<int> enemyWidths   = { 70, 70, 60, 60, 60 };   // Swordfish, Eel, Octopus, Angler, Shark widths
+    std::vector<int> enemyHeights  = { 50, 30, 60, 55, 40 };   // Swordfish, Eel, Octopus, Angler, Shark heights
+
+    int submarineWidth = 112;
+    int submarineHeight = 112;
+
+    // Balance knobs (frames are 1/60 s)
+    int spawnInterval = 120;          // Levels 2-3: frames between animal spawns
+    int maxActiveEnemies = 2;         // Levels 2-3: animals on screen at once
+    int stormSpawnInterval = 120;     // Level 4
+    int stormMaxActiveEnemies = 4;    // Level 4
+    int stormFrames = 1800;           // Level 4 length (60 seconds)
+};
+
+// Player input for a single simulation tick
+struct SimInput {
+    bool up = false;
+    bool down = false;
+    bool left = false;
+    bool right = false;
+    bool calm = false;    // SPACE calm pulse
+};
+
+// Things that happened during a tick. The simulation never plays sounds or
+// touches the scoreboard itself; the game reacts to these instead.
+enum class SimEventType {
+    LitterCollected,   // value = points gained
+    LitterMissed,      // value = points lost
+    EnemyHit,          // value = lives lost, enemyType = animal that hit us
+    LevelChanged,      // value = new level, enemyType unused
+    StormWarning,      // Level 4 timer entered its last ~11 seconds
+};
+
+struct SimEvent {
+    SimEventType type;
+    int value = 0;
+    int enemyType = -1;
+};
@@ -0,0 +1,103 @@
+#pragma once
+#include <variant>
+#include <vector>
+#include "SimTypes.h"
+#include "Level.h"
+#include "Submarine.h"
+
+// Headless game simulation: owns the submarine, the active level and the
+// score/lives/level progression. One call to step() is one 60 fps frame.
+// GameManager drives it with keyboard input and renders from its state;
+// tools and tests can drive it directly without SDL.
+// The seed decides every random roll, so a seed plus the inputs given to
+// step() always reproduce the same game.
+// One object of each level is made up front and all of them work on the
+// one World here. Moving up a level starts the next level's rules on the
+// same litter and animals, so level changes and restarts don't allocate
+// or copy anything. The level being played is also kept by its concrete
+// type (ActiveLevel), and step() dispatches on that once per tick.
+class Simulation {
+public:
+    // The level being played, as its own type
+    using ActiveLevel = std::variant<Level1*, Level2*, Level3*, Level4*>;
+
+    Simulation(const SimConfig& config = SimConfig(), uint64_t seed = Rng::DEFAULT_SEED);
+
+    // Back to Level 1 (reset in place), score 0 and 3 lives
+    // (levels keep drawing seeds from the same sequence, so a restart
+    // plays differently but still deterministically)
+    void reset();
+    // Same, but play as a new Simulation made with `seed` would
+    void reset(uint64_t seed);
+
+    // Advance the game by one frame
+    void step(const SimInput& input);
+
+    // Split the levels' entity updates across `pool` (nullptr: don't).
+    // Same results either way; see Level::setJobPool.
+    void setJobPool(JobPool* pool, int grain = Level::DEFAULT_JOB_GRAIN);
+
+    // Events produced by the last step()
+    const std::vector<SimEvent>& getEvents() const { return events; }
+
+    Level& getLevel() { return *level; }
+    const Level& getLevel() const { return *level; }
+    ActiveLevel getActiveLevel() const { return active; }
+    Submarine& getSubmarine() { return submarine; }
+    const Submarine& getSubmarine() const { return submarine; }
+
+    uint64_t getSeed() const { return seed; }
+    int getScore() const { return score; }
+    int getLives() const { return lives; }
+    int getLevelNumber() const { return currentLevel; }
+    bool isGameOver() const { return gameOver; }
+    bool isVictory() const { return victory; }
+    bool isShowingLevel4Intro() const { return showingLevel4Intro; }
+    int getLevel4IntroTimer() const { return level4IntroTimer; }
+
+    // Score thresholds (100/200/400) that move the game to the next level
+    static int levelForScore(int score, int level);
+
+    // Score that ends `level`, or -1 for the last level
+    static int scoreToLeaveLevel(int level);
+
+private:
+    // Make level `number` the active one and start it with the next seed.
+    // keepWorld: carry on with the litter and animals already there
+    // (Level::enter), otherwise start from the level's own opening
+    // (Level::reset).
+    void startLevel(int number, bool keepWorld);
+    // One tick of input and level update, for the active level's type
+    template <typename L>
+    void stepLevel(L& active, const SimInput& input);
+    void applyEvents();
+    void changeLevel(int newLevel);
+
+    SimConfig config;
+    uint64_t seed;
+    Rng levelSeeds;      // Each new level gets its own seed from here
+    Submarine submarine;
+    World world;                  // Litter and animals, shared by the levels
+    Level1 level1;                // Levels 1-4, made once
+    Level2 level2;
+    Level3 level3;
+    Level4 level4;
+    static const int LEVEL_COUNT = 4;
+    Level* levels[LEVEL_COUNT];   // The same four, for what every level does
+    ActiveLevel active;           // The one being played...
+    Level* level;                 // ...and the same as a Level
+    std::vector<SimEvent> events;
+    JobPool* jobPool;
+    int jobGrain;
+
+    int score;
+    int lives;
+    int currentLevel;
+    bool gameOver;
+    bool victory;
+
+    // Level 4 intro sequence (gameplay paused for 3 seconds)
+    bool showingLevel4Intro;
+    int level4IntroTimer;
+    bool stormWarningSent;
+};
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "SimTypes.h"
+
+// Uniform grid broadphase.
+// The play area (plus a margin for things spawning off-screen) is cut into
+// square cells and every entity is listed in each cell its rect touches.
+// Queries only visit the cells under the query area, so their cost depends
+// on how crowded that spot is, not on how many entities exist. Anything
+// outside the grid bounds is clamped into the edge cells.
+//
+// Entities are identified by the index the caller passes to insert()
+// (normally their index in the level's vector). The grid can be kept up to
+// date incrementally: inserting an id that's already there moves it, and
+// only touches the cell lists if it crossed into other cells (most moves
+// don't, cells are much bigger than a tick's movement). clear() empties
+// the cells but keeps their memory, for when the ids change meaning.
+class SpatialGrid {
+public:
+    SpatialGrid(int cellSize = 64, int minX = -256, int minY = -256, int maxX = 1088, int maxY = 856);
+
+    void clear();
+
+    // Add `id`, or move it if it's already in. Center defaults to the
+    // middle of the rect. Pass the exact float center if radius queries
+    // need to match a float distance check.
+    void insert(int id, const SimRect& rect);
+    void insert(int id, const SimRect& rect, float centerX, float centerY);
+
+    // Take `id` out (nothing happens if it isn't in)
+    void remove(int id);
+
+    // Ids whose rect overlaps `area` (same strict test as rectsOverlap)
+    void queryRect(const SimRect& area, std::vector<int>& out) const;
+
+    // Ids whose center is within `radius` of (cx, cy)
+    void queryRadius(float cx, float cy, float radius, std::vector<int>& out) const;
+
+    int getCellSize() const { return cellSize; }
+
+private:
+    struct Item {
+        SimRect rect;
+        float cx, cy;
+        int c0, r0, c1, r1;   // Cells it's listed in
+        bool listed;
+    };
+
+    void cellRange(int x0, int y0, int x1, int y1, int& c0, int& r0, int& c1, int& r1) const;
+    void unlist(int id);
+
+    int cellSize;
+    int originX, originY;
+    int cols, rows;
+    std::vector<std::vector<int>> cells;
+    std::vector<Item> items;               // Indexed by id
+    std::vector<int> usedCells;            // Cells to empty on clear()
+    std::vector<uint8_t> cellUsed;         // Set = already in usedCells
+
+    // Stops entities that span several cells from being reported twice
+    mutable std::vector<unsigned> seenStamp;
+    mutable unsigned queryStamp;
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+
+// All gameplay sprites packed into one texture.
+// Images are scaled to the size they're drawn at when they are added, and
+// sprites that need it also get pre-flipped and pre-tinted (hit-blink red)
+// copies, so drawing never has to touch color mods or use RenderCopyEx.
+// Everything is uploaded once in build().
+class SpriteAtlas {
+public:
+    enum Variant {
+        NORMAL = 0,
+        FLIPPED,          // Mirrored horizontally
+        TINTED,           // Red hit-blink (same as color mod 255,100,100)
+        FLIPPED_TINTED,
+        VARIANT_COUNT
+    };
+
+    SpriteAtlas(SDL_Renderer* renderer);
+    ~SpriteAtlas();
+
+    // Queue an image for sprite ID `sprite`, scaled to w x h. The surface is
+    // copied so the caller still owns it. withVariants adds the flipped and
+    // tinted copies.
+    void add(int sprite, SDL_Surface* image, int w, int h, bool withVariants);
+
+    // Pack everything queued and upload it as one texture
+    bool build();
+
+    SDL_Texture* getTexture() const { return texture; }
+
+    // Where a sprite lives in the atlas (nullptr if it was never added).
+    // Sprites without variants fall back to NORMAL.
+    const SDL_Rect* getRegion(int sprite, Variant variant = NORMAL) const;
+
+private:
+    static const int ATLAS_WIDTH = 1024;
+
+    struct Entry {
+        bool present;
+        bool hasVariants;
+        SDL_Rect regions[VARIANT_COUNT];
+    };
+
+    // An image waiting to be packed
+    struct Pending {
+        int sprite;
+        int variant;
+        SDL_Surface* surface;
+    };
+
+    SDL_Renderer* renderer;
+    SDL_Texture* texture;
+    std::vector<Entry> entries;     // Indexed by sprite ID
+    std::vector<Pending> pending;
+};
@@ -0,0 +1,32 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+
+// Collects textured quads and submits them with SDL_RenderGeometry.
+// Quads are grouped by texture, so a whole layer drawn from the sprite
+// atlas goes out as a single draw call on flush(). Within one texture the
+// quads keep the order they were added in. Tint and alpha go through the
+// vertex color instead of SDL_SetTextureColorMod/AlphaMod.
+class SpriteBatch {
+public:
+    SpriteBatch(SDL_Renderer* renderer);
+
+    void draw(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dest,
+              SDL_Color color = SDL_Color{ 255, 255, 255, 255 });
+
+    // Submit everything queued (one call per texture) and start over
+    void flush();
+
+private:
+    struct Bucket {
+        SDL_Texture* texture;
+        float texW, texH;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+    };
+
+    Bucket& getBucket(SDL_Texture* texture);
+
+    SDL_Renderer* renderer;
+    std::vector<Bucket> buckets;   // Kept between flushes so drawing doesn't allocate
+};
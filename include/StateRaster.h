@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Level.h"
+#include "Submarine.h"
+
+// Low-resolution, multi-channel picture of the game state for bots,
+// heatmaps and replay analysis. The 800x600 screen maps onto an 80x60 grid
+// of 10x10 pixel cells, one uint8 plane per channel, with no SDL involved.
+//
+// Layout is planar (channel, row, column): plane(c)[gy * WIDTH + gx]. A
+// cell is 255 when anything of that kind overlaps it (ink uses the spot's
+// current opacity instead). Everything is drawn as whole-cell row spans,
+// so rasterizing a full Level 4 tick is a few hundred short fills.
+class StateRaster {
+public:
+    static constexpr int CELL = 10;                   // Screen pixels per cell
+    static constexpr int WIDTH = 800 / CELL;
+    static constexpr int HEIGHT = 600 / CELL;
+    static constexpr int PLANE_SIZE = WIDTH * HEIGHT;
+
+    enum Channel {
+        CH_LITTER = 0,       // Litter items and the Level 4 flow
+        CH_SWORDFISH,        // CH_SWORDFISH + enemyType
+        CH_EEL,
+        CH_OCTOPUS,
+        CH_ANGLER,
+        CH_SHARK,
+        CH_INK,              // Octopus ink spots
+        CH_BLACKOUT,         // Level 3 blackout region
+        CH_SUBMARINE,
+        CHANNEL_COUNT
+    };
+    static constexpr int SIZE = PLANE_SIZE * CHANNEL_COUNT;
+
+    StateRaster();
+
+    // Redraw every channel from the current state
+    void rasterize(const Level& level, const Submarine& submarine);
+
+    const uint8_t* data() const { return cells.data(); }
+    const uint8_t* plane(int channel) const { return cells.data() + channel * PLANE_SIZE; }
+    uint8_t at(int channel, int gx, int gy) const { return plane(channel)[gy * WIDTH + gx]; }
+
+private:
+    // Screen-pixel rect, clipped to the grid
+    void fillRect(int channel, int x, int y, int w, int h, uint8_t value);
+
+    // Same, but keeps the brighter of the old and new value (overlapping ink)
+    void maxRect(int channel, int x, int y, int w, int h, uint8_t value);
+
+    // Cell span [gx0, gx1) on row gy
+    void fillSpan(int channel, int gy, int gx0, int gx1, uint8_t value);
+
+    // Clip a pixel rect to cell ranges; false if nothing is left
+    static bool toCells(int x, int y, int w, int h, int& gx0, int& gy0, int& gx1, int& gy1);
+
+    void rasterizeBlackout(const Level& level);
+
+    std::vector<uint8_t> cells;
+};
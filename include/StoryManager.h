@@ -3,10 +3,10 @@
 #include <vector>
 #include "Level.h"
 #include "Messages.h"
+#include "TextRenderer.h"
 #include "Level.h"
 
 class Level;
-class Level4;
 struct LevelInfo
 {
     std::string zoneName;
@@ -27,6 +27,7 @@ struct LevelInfo
 class StoryManager {
 public:
     StoryManager(Messages* msg);
+    ~StoryManager();
 
     void reset();
     void onLevelChange(int newLevel);
@@ -38,6 +39,9 @@ public:
     void setLevelPointer(Level* lvl) { currentLevelPtr = lvl; }
 
     void update(int score, int level, int timeRemaining);
+    // Creates the banner font. Call on the thread that owns the renderer,
+    // before renderLevelChange (which may be recording on another thread).
+    void loadFont(SDL_Renderer* renderer);
     void renderLevelChange(SDL_Renderer* renderer);
 
     bool animalMessagePlayed = false;
@@ -55,4 +59,5 @@ private:
     Uint32 lvlChangeStart = 0;
     bool lvlChangeActive = false;
     int lvlChangeDuration = 3500;
+    TextRenderer* bannerText = nullptr;  // Created by loadFont
 };
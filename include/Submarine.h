@@ -1,24 +1,27 @@
 #pragma once
-#include <SDL.h>
+#include "SimTypes.h"
 
 class Submarine {
 public:
-    Submarine(SDL_Texture* tex, int x, int y, int w, int h);
+    Submarine(int sprite, int x, int y, int w, int h);
     ~Submarine();
 
     void setPosition(int x, int y);
     void moveBy(int dx, int dy);
     void clamp(int minX, int maxX, int minY, int maxY);
-    void render(SDL_Renderer* renderer);
-    SDL_Rect getRect() const;
+    SimRect getRect() const;
     void startHitBlink();  
     void updateBlink();
     bool isInvulnerable() const;
     void reset();    
 
+    int getSprite() const { return sprite; }
+    int getHitBlinkTimer() const { return hitBlinkTimer; }
+    bool isFacingRight() const { return facingRight; }
+
 private:
-    SDL_Texture* texture;
-    SDL_Rect rect;
+    int sprite;
+    SimRect rect;
     int hitBlinkTimer = 0;  
     bool facingRight = true;  
 };
@@ -0,0 +1,55 @@
+#pragma once
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <string>
+#include <vector>
+#include "GlyphAtlas.h"
+
+// Draws text for one font from a glyph atlas.
+// The atlas (every printable ASCII glyph, rasterized once in white) comes
+// from FontManager and is shared by every TextRenderer using that font, so
+// a font is only rasterized and uploaded the first time anyone draws with
+// it. Strings are drawn as textured quads with one SDL_RenderGeometry call,
+// tinted through the vertex color, so nothing is rasterized or uploaded per
+// frame. Wrapping is computed from the cached glyph advances and follows
+// TTF_RenderText_Blended_Wrapped.
+class TextRenderer {
+public:
+    TextRenderer(SDL_Renderer* renderer, TTF_Font* font);
+
+    // Single line, top-left corner at (x, y)
+    void draw(const std::string& text, int x, int y, SDL_Color color);
+
+    // Word wrapped to wrapWidth pixels (also breaks on '\n')
+    void drawWrapped(const std::string& text, int x, int y, SDL_Color color, int wrapWidth);
+
+    // Size the text takes up when drawn (same as the TTF surface would be)
+    void measure(const std::string& text, int* w, int* h) const;
+    void measureWrapped(const std::string& text, int wrapWidth, int* w, int* h) const;
+
+    int getLineHeight() const { return atlas ? atlas->lineSkip : 0; }
+    bool isLoaded() const { return atlas && atlas->texture; }
+
+private:
+    typedef GlyphAtlas::Glyph Glyph;
+
+    // A line of text as [begin, end) into the string
+    struct Line {
+        size_t begin;
+        size_t end;
+    };
+
+    const Glyph* getGlyph(char c) const { return atlas ? atlas->getGlyph(c) : nullptr; }
+    int measureRange(const std::string& text, size_t begin, size_t end) const;
+    void wrapLines(const std::string& text, int wrapWidth, std::vector<Line>& lines) const;
+    void addQuads(const std::string& text, size_t begin, size_t end, float x, float y, SDL_Color color);
+    void flush();
+
+    SDL_Renderer* renderer;
+    const GlyphAtlas* atlas;  // Owned by FontManager
+
+    // Reused between draws so drawing doesn't allocate
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    std::vector<Line> lines;
+};
@@ -0,0 +1,139 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Simulation.h"
+#include "StateRaster.h"
+
+// Reinforcement-learning style wrapper around Simulation: pick one of
+// ACTION_COUNT actions, get a reward and a fixed-size observation back.
+// The game rules are untouched (same levels, submarine bounds, score and
+// lives), so a policy trained here plays the real game.
+//
+// Actions are the 9 moves (stay + 8 directions) times calm off/on:
+//   action % 9  -> 0 stay, 1 up, 2 up-right, 3 right, 4 down-right,
+//                  5 down, 6 down-left, 7 left, 8 up-left
+//   action >= 9 -> SPACE calm pulse as well
+//
+// Observation (OBS_SIZE floats, roughly -1..1):
+//   [0..5]  submarine center x, y, lives, level, in blackout, Level 4 time left
+//   then the NEAREST_LITTER closest litter:   dx, dy, present
+//   then the NEAREST_ENEMIES closest animals: dx, dy, present, harmless (calmed
+//                                             or falling), type
+// Positions are relative to the submarine, nearest first; empty slots are 0.
+class TideSweeperEnv {
+public:
+    static constexpr int MOVE_COUNT = 9;
+    static constexpr int ACTION_COUNT = MOVE_COUNT * 2;
+    static constexpr int NEAREST_LITTER = 8;
+    static constexpr int NEAREST_ENEMIES = 4;
+    static constexpr int OBS_SIZE = 6 + NEAREST_LITTER * 3 + NEAREST_ENEMIES * 5;
+    static constexpr int DEFAULT_MAX_STEPS = 60 * 60 * 5;   // 5 game minutes
+
+    // Reward: score change (+1 per litter, -1 per miss), lives, and winning
+    static constexpr float REWARD_PER_POINT = 0.1f;
+    static constexpr float REWARD_LIFE_LOST = -5.0f;
+    static constexpr float REWARD_VICTORY = 10.0f;
+
+    struct StepResult {
+        float reward = 0.0f;
+        bool terminated = false;   // Game over or victory
+        bool truncated = false;    // Hit maxSteps
+    };
+
+    // actionRepeat: ticks each step() plays the same action for
+    TideSweeperEnv(const SimConfig& config = SimConfig(), int maxSteps = DEFAULT_MAX_STEPS, int actionRepeat = 1);
+    ~TideSweeperEnv();
+    TideSweeperEnv(const TideSweeperEnv&) = delete;
+    TideSweeperEnv& operator=(const TideSweeperEnv&) = delete;
+
+    // New game from the start of Level 1
+    void reset(uint64_t seed);
+
+    // Play one action. After the episode ends, call reset() before stepping again.
+    StepResult step(int action);
+
+    // Write OBS_SIZE floats for the current state
+    void observe(float* out) const;
+
+    // The same state as an 80x60 occupancy grid (for convolutional policies)
+    void observeRaster(StateRaster& raster) const { raster.rasterize(sim->getLevel(), sim->getSubmarine()); }
+
+    bool isDone() const { return done; }
+    int getStepCount() const { return steps; }
+    const Simulation& getSimulation() const { return *sim; }
+
+    static SimInput actionToInput(int action);
+
+private:
+    SimConfig config;
+    int maxSteps;
+    int actionRepeat;
+    Simulation* sim;
+    int steps;
+    bool done;
+
+    // Scratch for the nearest-first sort (distance, index)
+    mutable std::vector<std::pair<float, int>> nearest;
+};
+
+// K environments stepped in lockstep across a fixed set of threads.
+// step() takes one action per environment and fills flat arrays of
+// observations (size() * OBS_SIZE), rewards and done flags. An environment
+// whose episode ended starts a new one straight away; its done flag is set
+// for that step and its observation is already from the new episode.
+//
+// Seeds: environment i plays seed + i first, then seed + i + size(),
+// seed + i + 2 * size() and so on, so results don't depend on the thread
+// count.
+class VecEnv {
+public:
+    VecEnv(int count, const SimConfig& config = SimConfig(), int threadCount = 0,
+           int maxSteps = TideSweeperEnv::DEFAULT_MAX_STEPS, int actionRepeat = 1);
+    ~VecEnv();
+    VecEnv(const VecEnv&) = delete;
+    VecEnv& operator=(const VecEnv&) = delete;
+
+    int size() const { return (int)envs.size(); }
+
+    void reset(uint64_t seed);
+    void step(const int* actions);
+
+    const float* getObservations() const { return observations.data(); }
+    const float* getRewards() const { return rewards.data(); }
+    const uint8_t* getDones() const { return dones.data(); }
+    const uint8_t* getTruncated() const { return truncated.data(); }
+
+    TideSweeperEnv& getEnv(int i) { return *envs[i]; }
+
+private:
+    // What the threads are asked to do with their slice
+    enum class Job { Reset, Step };
+
+    void runJob(int chunk);
+    void workerLoop(int chunk);
+    void runAll(Job job);
+
+    std::vector<TideSweeperEnv*> envs;
+    std::vector<int> episodes;          // Finished episodes per env (picks the next seed)
+    uint64_t baseSeed;
+
+    std::vector<float> observations;
+    std::vector<float> rewards;
+    std::vector<uint8_t> dones;
+    std::vector<uint8_t> truncated;
+    const int* pendingActions;
+
+    // Lockstep pool: chunk 0 runs on the calling thread
+    int chunkCount;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+    Job job;
+    unsigned generation;      // Bumped for every job
+    int busyWorkers;
+    bool stopping;
+};
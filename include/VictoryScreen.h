@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include "TextRenderer.h"
 
 
 
@@ -17,14 +18,15 @@ public:
 
 private:
     SDL_Renderer* renderer;
-    TTF_Font* fontLarge;
-    TTF_Font* fontSmall;
-
     TTF_Font* fontTitle;     
     TTF_Font* fontStats;    
-    TTF_Font* fontHeader;    
     TTF_Font* fontBody;      
 
+    // Glyph atlases for the fonts drawn each frame
+    TextRenderer* titleText;
+    TextRenderer* statsText;
+    TextRenderer* bodyText;
+
     SDL_Texture* bgTexture = nullptr;
 
 
@@ -0,0 +1,19 @@
+#pragma once
+#include <vector>
+#include "Litter.h"
+#include "Enemies.h"
+
+// The litter and animals in the water. They outlive any one level: the
+// Simulation keeps one World and every level works on it, so moving to
+// the next level changes the rules, not the entities (see Level::enter).
+// Level-specific state (timers, ink, the Level 4 flow) stays in the level.
+struct World {
+    std::vector<Litter> litter;
+    std::vector<Enemies> enemies;
+
+    // Empties both lists but keeps their storage
+    void clear() {
+        litter.clear();
+        enemies.clear();
+    }
+};
@@ -0,0 +1,162 @@
+#include "AssetCache.h"
+#include <SDL_image.h>
+#include <iostream>
+#include "AssetLoader.h"
+#include "Profiler.h"
+#include "RenderStats.h"
+
+int AssetCache::loadCount = 0;
+
+std::map<std::string, AssetCache::Entry<SDL_Surface>>& AssetCache::images() {
+    static std::map<std::string, Entry<SDL_Surface>> entries;
+    return entries;
+}
+
+std::map<std::string, AssetCache::Entry<SDL_Texture>>& AssetCache::textures() {
+    static std::map<std::string, Entry<SDL_Texture>> entries;
+    return entries;
+}
+
+std::map<std::string, AssetCache::Entry<Mix_Chunk>>& AssetCache::chunks() {
+    static std::map<std::string, Entry<Mix_Chunk>> entries;
+    return entries;
+}
+
+std::map<std::string, AssetCache::Entry<Mix_Music>>& AssetCache::music() {
+    static std::map<std::string, Entry<Mix_Music>> entries;
+    return entries;
+}
+
+SDL_Surface* AssetCache::acquireImage(const std::string& path) {
+    auto it = images().find(path);
+    if (it == images().end()) {
+        PROFILE_ZONE("AssetCache::loadImage");
+        loadCount++;
+        SDL_Surface* image = IMG_Load(path.c_str());
+        if (!image) {
+            std::cerr << "Failed to load image: " << path << " | " << IMG_GetError() << std::endl;
+        }
+        it = images().insert({ path, { image, 0 } }).first;
+    }
+    it->second.refs++;
+    return it->second.asset;
+}
+
+SDL_Texture* AssetCache::acquireTexture(SDL_Renderer* renderer, const std::string& path, AssetLoader* loader) {
+    auto it = textures().find(path);
+    if (it == textures().end()) {
+        PROFILE_ZONE("AssetCache::loadTexture");
+        loadCount++;
+        SDL_Texture* texture = nullptr;
+        if (loader) {
+            texture = loader->takeTexture(renderer, path);  // Reports its own errors
+        } else {
+            SDL_Surface* surface = IMG_Load(path.c_str());
+            if (surface) {
+                texture = RenderStats::createTexture(renderer, surface);
+                SDL_FreeSurface(surface);
+            } else {
+                std::cerr << "Failed to load image: " << path << " | " << IMG_GetError() << std::endl;
+            }
+        }
+        it = textures().insert({ path, { texture, 0 } }).first;
+    }
+    it->second.refs++;
+    return it->second.asset;
+}
+
+Mix_Chunk* AssetCache::acquireChunk(const std::string& path) {
+    auto it = chunks().find(path);
+    if (it == chunks().end()) {
+        PROFILE_ZONE("AssetCache::loadChunk");
+        loadCount++;
+        Mix_Chunk* chunk = Mix_LoadWAV(path.c_str());
+        if (!chunk) {
+            std::cerr << "Failed to load sound: " << path << " | " << Mix_GetError() << std::endl;
+        }
+        it = chunks().insert({ path, { chunk, 0 } }).first;
+    }
+    it->second.refs++;
+    return it->second.asset;
+}
+
+Mix_Music* AssetCache::acquireMusic(const std::string& path) {
+    auto it = music().find(path);
+    if (it == music().end()) {
+        PROFILE_ZONE("AssetCache::loadMusic");
+        loadCount++;
+        Mix_Music* track = Mix_LoadMUS(path.c_str());
+        if (!track) {
+            std::cerr << "Failed to load music: " << path << " | " << Mix_GetError() << std::endl;
+        }
+        it = music().insert({ path, { track, 0 } }).first;
+    }
+    it->second.refs++;
+    return it->second.asset;
+}
+
+// Only a few dozen entries, so a scan is fine
+template <typename T>
+void AssetCache::releaseIn(std::map<std::string, Entry<T>>& entries, T* asset) {
+    if (!asset) return;
+    for (auto& entry : entries) {
+        if (entry.second.asset == asset) {
+            if (entry.second.refs > 0) entry.second.refs--;
+            return;
+        }
+    }
+    std::cerr << "AssetCache: released an asset it doesn't own" << std::endl;
+}
+
+void AssetCache::release(SDL_Surface* image) { releaseIn(images(), image); }
+void AssetCache::release(SDL_Texture* texture) { releaseIn(textures(), texture); }
+void AssetCache::release(Mix_Chunk* chunk) { releaseIn(chunks(), chunk); }
+void AssetCache::release(Mix_Music* track) { releaseIn(music(), track); }
+
+bool AssetCache::hasTexture(const std::string& path) {
+    return textures().count(path) > 0;
+}
+
+int AssetCache::getRefCount(const std::string& path) {
+    int refs = 0;
+    auto image = images().find(path);
+    if (image != images().end()) refs += image->second.refs;
+    auto texture = textures().find(path);
+    if (texture != textures().end()) refs += texture->second.refs;
+    auto chunk = chunks().find(path);
+    if (chunk != chunks().end()) refs += chunk->second.refs;
+    auto track = music().find(path);
+    if (track != music().end()) refs += track->second.refs;
+    return refs;
+}
+
+void AssetCache::freeAsset(SDL_Surface* image) { SDL_FreeSurface(image); }
+void AssetCache::freeAsset(SDL_Texture* texture) { RenderStats::destroyTexture(texture); }
+void AssetCache::freeAsset(Mix_Chunk* chunk) { Mix_FreeChunk(chunk); }
+void AssetCache::freeAsset(Mix_Music* track) { Mix_FreeMusic(track); }  // Stops it if it's playing
+
+template <typename T>
+void AssetCache::purgeIn(std::map<std::string, Entry<T>>& entries, bool all) {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (all || it->second.refs == 0) {
+            if (it->second.asset) freeAsset(it->second.asset);
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void AssetCache::purgeUnused() {
+    purgeIn(images(), false);
+    purgeIn(textures(), false);
+    purgeIn(chunks(), false);
+    purgeIn(music(), false);
+}
+
+void AssetCache::shutdown() {
+    purgeIn(images(), true);
+    purgeIn(textures(), true);
+    purgeIn(chunks(), true);
+    purgeIn(music(), true);
+}
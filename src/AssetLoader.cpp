@@ -0,0 +1,116 @@
+#include "AssetLoader.h"
+#include "Profiler.h"
+#include "RenderStats.h"
+#include <SDL_image.h>
+#include <iostream>
+
+AssetLoader::AssetLoader(int threadCount)
+    : stopping(false)
+{
+    if (threadCount < 1) threadCount = 1;
+    for (int i = 0; i < threadCount; i++) {
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+}
+
+AssetLoader::~AssetLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread& t : workers) t.join();
+
+    // Anything decoded but never taken
+    for (auto& entry : jobs) {
+        if (entry.second.surface) SDL_FreeSurface(entry.second.surface);
+    }
+}
+
+void AssetLoader::request(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (jobs.count(path)) return;
+        jobs[path] = { State::Queued, nullptr };
+        queue.push_back(path);
+    }
+    workAvailable.notify_one();
+}
+
+bool AssetLoader::isReady(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = jobs.find(path);
+    return it != jobs.end() && it->second.state == State::Done;
+}
+
+SDL_Texture* AssetLoader::takeTexture(SDL_Renderer* renderer, const std::string& path) {
+    PROFILE_ZONE("AssetLoader::takeTexture");
+    SDL_Surface* surface = nullptr;
+    bool loadHere = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        auto it = jobs.find(path);
+        if (it == jobs.end() || it->second.state == State::Queued) {
+            // Not started yet: faster to decode it ourselves than to wait
+            // behind the rest of the queue
+            if (it != jobs.end()) {
+                for (auto q = queue.begin(); q != queue.end(); ++q) {
+                    if (*q == path) { queue.erase(q); break; }
+                }
+                jobs.erase(it);
+            }
+            loadHere = true;
+        } else {
+            jobFinished.wait(lock, [&] { return jobs[path].state == State::Done; });
+            surface = jobs[path].surface;
+            jobs.erase(path);
+        }
+    }
+
+    if (loadHere) {
+        PROFILE_ZONE("AssetLoader::decode (sync)");
+        surface = IMG_Load(path.c_str());
+        if (!surface) {
+            std::cerr << "Failed to load image: " << path << " | " << IMG_GetError() << std::endl;
+        }
+    }
+    if (!surface) return nullptr;
+
+    PROFILE_ZONE("AssetLoader::upload");
+    SDL_Texture* texture = RenderStats::createTexture(renderer, surface);
+    SDL_FreeSurface(surface);
+    return texture;
+}
+
+void AssetLoader::workerLoop() {
+    PROFILE_THREAD_NAME("AssetLoader");
+    while (true) {
+        std::string path;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workAvailable.wait(lock, [&] { return stopping || !queue.empty(); });
+            if (stopping) return;
+
+            path = queue.front();
+            queue.pop_front();
+            jobs[path].state = State::Loading;
+        }
+
+        // The slow part, done without holding the lock
+        SDL_Surface* surface;
+        {
+            PROFILE_ZONE("AssetLoader::decode");
+            surface = IMG_Load(path.c_str());
+        }
+        if (!surface) {
+            std::cerr << "Failed to load image: " << path << " | " << IMG_GetError() << std::endl;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs[path].surface = surface;
+            jobs[path].state = State::Done;
+        }
+        jobFinished.notify_all();
+    }
+}
@@ -0,0 +1,80 @@
+#include "Autopilot.h"
+#include <cmath>
+
+namespace {
+// Animals that can still hurt us. Calmed ones only stop chasing: they
+// still swim left through the submarine.
+bool isThreat(const Enemies& e) {
+    return e.active && !e.falling;
+}
+}
+
+SimInput Autopilot::decide(const Simulation& sim) {
+    const Level& level = sim.getLevel();
+    const std::vector<Enemies>& enemies = level.getEnemyItems();
+    SimRect sub = sim.getSubmarine().getRect();
+    float subX = sub.x + sub.w / 2.0f;
+    float subY = sub.y + sub.h / 2.0f;
+
+    // Target: closest litter, with litter near an animal counted as further away
+    float bestCost = -1.0f, targetX = subX, targetY = subY;
+    auto consider = [&](float cx, float cy) {
+        if (cx > 800.0f || cx < 0.0f) return;  // Not on screen (yet)
+        float cost = std::sqrt((cx - subX) * (cx - subX) + (cy - subY) * (cy - subY));
+        for (const Enemies& e : enemies) {
+            if (!isThreat(e)) continue;
+            float dx = e.x + e.width / 2.0f - cx;
+            float dy = e.y + e.height / 2.0f - cy;
+            if (dx * dx + dy * dy < AVOID_RADIUS * AVOID_RADIUS) cost += 300.0f;
+        }
+        if (bestCost < 0.0f || cost < bestCost) {
+            bestCost = cost;
+            targetX = cx;
+            targetY = cy;
+        }
+    };
+    for (const Litter& l : level.getLitterItems()) {
+        if (l.active) consider(l.x + l.getWidth() / 2.0f, l.y + l.getHeight() / 2.0f);
+    }
+    const EntityStore& flow = level.getLitterFlow();
+    for (int i = 0; i < flow.size(); i++) {
+        if (flow.flags[i] & EntityStore::FLAG_ACTIVE) {
+            consider(flow.x[i] + flow.width[i] / 2.0f, flow.y[i] + flow.height[i] / 2.0f);
+        }
+    }
+
+    // Pull toward the target (unit length), push away from close animals
+    float moveX = 0.0f, moveY = 0.0f;
+    float toX = targetX - subX, toY = targetY - subY;
+    float toLength = std::sqrt(toX * toX + toY * toY);
+    if (toLength > DEAD_ZONE) {
+        moveX = toX / toLength;
+        moveY = toY / toLength;
+    }
+
+    SimInput input;
+    for (const Enemies& e : enemies) {
+        if (!isThreat(e)) continue;
+        float dx = subX - (e.x + e.width / 2.0f);
+        float dy = subY - (e.y + e.height / 2.0f);
+        float dist = std::sqrt(dx * dx + dy * dy);
+        float radius = e.enemyType == 4 ? SHARK_AVOID_RADIUS : AVOID_RADIUS;
+
+        if (dist < CALM_RADIUS && !e.calmed) input.calm = true;
+        if (dist < radius && dist > 0.0f) {
+            // Stronger the closer it is
+            float push = 2.0f * (radius - dist) / radius;
+            // Animals outswim us, so mostly dodge up or down out of their lane
+            moveX += dx / dist * push * 0.5f;
+            moveY += (dy >= 0.0f ? 1.0f : -1.0f) * push * 1.5f;
+        }
+    }
+
+    // Threshold the direction into keys (diagonals when both are large)
+    const float threshold = 0.35f;
+    input.left = moveX < -threshold;
+    input.right = moveX > threshold;
+    input.up = moveY < -threshold;
+    input.down = moveY > threshold;
+    return input;
+}
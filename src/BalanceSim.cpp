@@ -0,0 +1,247 @@
+#include "BalanceSim.h"
+#include "Simulation.h"
+#include "Autopilot.h"
+#include "Rng.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace {
+
+const char* const ENEMY_NAMES[ENEMY_TYPE_COUNT] = { "swordfish", "eel", "octopus", "angler", "shark" };
+
+// Separate stream from anything the levels use
+const uint64_t POLICY_STREAM = 100;
+
+// Random: a random key combo held for 10-40 frames, like a button masher
+class RandomPolicy {
+public:
+    explicit RandomPolicy(uint64_t seed) : rng(seed, POLICY_STREAM), holdFrames(0) {}
+
+    SimInput next() {
+        if (holdFrames-- <= 0) {
+            holdFrames = rng.range(10, 40);
+            input.up = rng.chance(50);
+            input.down = !input.up && rng.chance(50);
+            input.left = rng.chance(50);
+            input.right = !input.left && rng.chance(50);
+            input.calm = rng.chance(20);
+        }
+        return input;
+    }
+
+private:
+    Rng rng;
+    SimInput input;
+    int holdFrames;
+};
+
+// Chase: steer the submarine's center at the closest litter
+SimInput chaseInput(const Simulation& sim) {
+    const Level& level = sim.getLevel();
+    SimRect sub = sim.getSubmarine().getRect();
+    float subX = sub.x + sub.w / 2.0f;
+    float subY = sub.y + sub.h / 2.0f;
+
+    float bestDist = -1.0f, targetX = subX, targetY = subY;
+    auto consider = [&](float cx, float cy) {
+        // Litter that's still off screen to the right can wait
+        if (cx > 800.0f) return;
+        float dist = (cx - subX) * (cx - subX) + (cy - subY) * (cy - subY);
+        if (bestDist < 0.0f || dist < bestDist) {
+            bestDist = dist;
+            targetX = cx;
+            targetY = cy;
+        }
+    };
+    for (const Litter& l : level.getLitterItems()) {
+        if (l.active) consider(l.x + l.getWidth() / 2.0f, l.y + l.getHeight() / 2.0f);
+    }
+    const EntityStore& flow = level.getLitterFlow();
+    for (int i = 0; i < flow.size(); i++) {
+        if (flow.flags[i] & EntityStore::FLAG_ACTIVE) {
+            consider(flow.x[i] + flow.width[i] / 2.0f, flow.y[i] + flow.height[i] / 2.0f);
+        }
+    }
+
+    SimInput input;
+    const float deadZone = 4.0f;
+    input.left = targetX < subX - deadZone;
+    input.right = targetX > subX + deadZone;
+    input.up = targetY < subY - deadZone;
+    input.down = targetY > subY + deadZone;
+
+    // Same radius the calm pulse covers
+    for (const Enemies& e : level.getEnemyItems()) {
+        if (e.calmed || e.falling) continue;
+        float dx = e.x + e.width / 2.0f - subX;
+        float dy = e.y + e.height / 2.0f - subY;
+        if (dx * dx + dy * dy < 150.0f * 150.0f) {
+            input.calm = true;
+            break;
+        }
+    }
+    return input;
+}
+
+// Seconds as text, or `missing` for -1
+void writeSeconds(std::ostream& out, int ticks, const char* missing) {
+    if (ticks < 0) {
+        out << missing;
+    } else {
+        out << ticks / 60.0;
+    }
+}
+
+}
+
+bool BalanceSim::parsePolicy(const std::string& name, Policy& policy) {
+    if (name == "idle") policy = Policy::Idle;
+    else if (name == "random") policy = Policy::Random;
+    else if (name == "chase") policy = Policy::Chase;
+    else if (name == "autopilot") policy = Policy::Autopilot;
+    else return false;
+    return true;
+}
+
+const char* BalanceSim::policyName(Policy policy) {
+    switch (policy) {
+    case Policy::Idle: return "idle";
+    case Policy::Random: return "random";
+    case Policy::Chase: return "chase";
+    case Policy::Autopilot: return "autopilot";
+    }
+    return "?";
+}
+
+BalanceSim::RunStats BalanceSim::runGame(const SimConfig& config, uint64_t seed, Policy policy, int maxTicks) {
+    RunStats stats;
+    stats.seed = seed;
+
+    Simulation sim(config, seed);
+    RandomPolicy random(seed);
+
+    while (stats.ticks < maxTicks && !sim.isGameOver()) {
+        SimInput input;
+        if (policy == Policy::Random) input = random.next();
+        else if (policy == Policy::Chase) input = chaseInput(sim);
+        else if (policy == Policy::Autopilot) input = Autopilot::decide(sim);
+
+        sim.step(input);
+        stats.ticks++;
+
+        for (const SimEvent& e : sim.getEvents()) {
+            switch (e.type) {
+            case SimEventType::LitterCollected:
+                stats.litterCollected++;
+                break;
+            case SimEventType::LitterMissed:
+                stats.litterMissed++;
+                break;
+            case SimEventType::EnemyHit:
+                if (e.enemyType >= 0 && e.enemyType < ENEMY_TYPE_COUNT) {
+                    stats.livesLost[e.enemyType] += e.value;
+                }
+                break;
+            case SimEventType::LevelChanged:
+                if (e.value >= 2 && e.value <= 4 && stats.levelTicks[e.value - 2] < 0) {
+                    stats.levelTicks[e.value - 2] = stats.ticks;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    stats.finalScore = sim.getScore();
+    stats.finalLevel = sim.getLevelNumber();
+    stats.victory = sim.isVictory();
+    stats.gameOver = sim.isGameOver() && !sim.isVictory();
+    if (stats.finalLevel == 4) stats.level4Score = stats.finalScore;
+    return stats;
+}
+
+std::vector<BalanceSim::RunStats> BalanceSim::runBatch(const Options& options) {
+    std::vector<RunStats> results(std::max(options.runs, 0));
+    if (results.empty()) return results;
+
+    int threadCount = options.threads;
+    if (threadCount <= 0) threadCount = int(std::thread::hardware_concurrency());
+    threadCount = std::max(1, std::min(threadCount, int(results.size())));
+
+    // Games take very different times (game over vs. full storm), so
+    // threads grab the next run as they finish instead of fixed chunks.
+    // Each run writes only its own slot.
+    std::atomic<int> nextRun(0);
+    auto worker = [&]() {
+        int run;
+        while ((run = nextRun++) < (int)results.size()) {
+            results[run] = runGame(options.config, options.seed + run, options.policy, options.maxTicks);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; i++) threads.emplace_back(worker);
+    worker();
+    for (std::thread& t : threads) t.join();
+    return results;
+}
+
+void BalanceSim::writeCsv(std::ostream& out, const std::vector<RunStats>& runs) {
+    out << "seed,seconds,level2_s,level3_s,level4_s";
+    for (const char* name : ENEMY_NAMES) out << ",lives_lost_" << name;
+    out << ",litter_collected,litter_missed,final_score,final_level,level4_score,victory,game_over\n";
+
+    for (const RunStats& r : runs) {
+        out << r.seed << ',' << r.ticks / 60.0;
+        for (int t : r.levelTicks) {
+            out << ',';
+            writeSeconds(out, t, "");
+        }
+        for (int lost : r.livesLost) out << ',' << lost;
+        out << ',' << r.litterCollected << ',' << r.litterMissed
+            << ',' << r.finalScore << ',' << r.finalLevel << ',';
+        if (r.level4Score >= 0) out << r.level4Score;
+        out << ',' << (r.victory ? 1 : 0) << ',' << (r.gameOver ? 1 : 0) << '\n';
+    }
+}
+
+void BalanceSim::writeJson(std::ostream& out, const Options& options, const std::vector<RunStats>& runs) {
+    const SimConfig& c = options.config;
+    out << "{\n";
+    out << "  \"policy\": \"" << policyName(options.policy) << "\",\n";
+    out << "  \"seed\": " << options.seed << ",\n";
+    out << "  \"max_seconds\": " << options.maxTicks / 60.0 << ",\n";
+    out << "  \"config\": { \"enemy_speeds\": [";
+    for (size_t i = 0; i < c.enemySpeeds.size(); i++) out << (i ? ", " : "") << c.enemySpeeds[i];
+    out << "], \"spawn_interval\": " << c.spawnInterval
+        << ", \"max_active_enemies\": " << c.maxActiveEnemies
+        << ", \"storm_spawn_interval\": " << c.stormSpawnInterval
+        << ", \"storm_max_active_enemies\": " << c.stormMaxActiveEnemies
+        << ", \"storm_frames\": " << c.stormFrames << " },\n";
+
+    out << "  \"runs\": [";
+    for (size_t i = 0; i < runs.size(); i++) {
+        const RunStats& r = runs[i];
+        out << (i ? ",\n" : "\n") << "    { \"seed\": " << r.seed << ", \"seconds\": " << r.ticks / 60.0;
+        const char* levelKeys[3] = { "level2_s", "level3_s", "level4_s" };
+        for (int l = 0; l < 3; l++) {
+            out << ", \"" << levelKeys[l] << "\": ";
+            writeSeconds(out, r.levelTicks[l], "null");
+        }
+        out << ", \"lives_lost\": {";
+        for (int t = 0; t < ENEMY_TYPE_COUNT; t++) {
+            out << (t ? ", " : " ") << '"' << ENEMY_NAMES[t] << "\": " << r.livesLost[t];
+        }
+        out << " }, \"litter_collected\": " << r.litterCollected
+            << ", \"litter_missed\": " << r.litterMissed
+            << ", \"final_score\": " << r.finalScore
+            << ", \"final_level\": " << r.finalLevel
+            << ", \"level4_score\": ";
+        if (r.level4Score >= 0) out << r.level4Score; else out << "null";
+        out << ", \"victory\": " << (r.victory ? "true" : "false")
+            << ", \"game_over\": " << (r.gameOver ? "true" : "false") << " }";
+    }
+    out << "\n  ]\n}\n";
+}
@@ -1,37 +1,36 @@
 #include "ChatUI.h"
+#include "AssetCache.h"
+#include "FontManager.h"
+#include "RenderStats.h"
 #include <iostream>
 
 ChatUI::ChatUI(SDL_Renderer* renderer, TTF_Font* chatFont)
     : renderer(renderer), chatFont(chatFont)
 {
-    briefFont = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 28); 
-    if (!briefFont) {
-        std::cerr << "Failed to load title font: " << TTF_GetError() << std::endl;
-    }
+    briefFont = FontManager::get(UI_FONT_PATH, 28); 
+
+    chatText = new TextRenderer(renderer, chatFont);
+    briefText = new TextRenderer(renderer, briefFont);
 }
 
 ChatUI::~ChatUI()
 {
-    if (commanderAvatar) SDL_DestroyTexture(commanderAvatar);
-    if (pilotAvatar) SDL_DestroyTexture(pilotAvatar);
-    if (sonarSprite) SDL_DestroyTexture(sonarSprite);   
+    AssetCache::release(commanderAvatar);
+    AssetCache::release(pilotAvatar);
+    AssetCache::release(chatBackground);
+    AssetCache::release(sonarSprite);
+    delete chatText;
+    delete briefText;
 
 }
 
 void ChatUI::loadAvatars(const std::string& commanderPath,
                          const std::string& pilotPath)
 {
-    SDL_Surface* cSurf = IMG_Load(commanderPath.c_str());
-    if (cSurf) {
-        commanderAvatar = SDL_CreateTextureFromSurface(renderer, cSurf);
-        SDL_FreeSurface(cSurf);
-    }
-
-    SDL_Surface* pSurf = IMG_Load(pilotPath.c_str());
-    if (pSurf) {
-        pilotAvatar = SDL_CreateTextureFromSurface(renderer, pSurf);
-        SDL_FreeSurface(pSurf);
-    }
+    AssetCache::release(commanderAvatar);
+    AssetCache::release(pilotAvatar);
+    commanderAvatar = AssetCache::acquireTexture(renderer, commanderPath);
+    pilotAvatar = AssetCache::acquireTexture(renderer, pilotPath);
 }
 
 void ChatUI::startBriefing(const std::string& playerName)
@@ -266,21 +265,19 @@ void ChatUI::render()
 
     // CHAT BACKGROUND 
     SDL_SetRenderDrawColor(renderer, 10, 20, 40, 255);
-    SDL_RenderFillRect(renderer, &chatRect);
+    RenderStats::fillRect(renderer, &chatRect);
 
     // TITLE BAR 
     const int titleHeight = 40;
     SDL_Rect titleRect = { chatRect.x, chatRect.y, chatRect.w, titleHeight };
     SDL_SetRenderDrawColor(renderer, 20, 35, 60, 255);
-    SDL_RenderFillRect(renderer, &titleRect);
+    RenderStats::fillRect(renderer, &titleRect);
 
     SDL_Color titleColor = {200, 220, 255, 255};
    
     // Measure text height first 
-    SDL_Surface* tempSurf = TTF_RenderText_Blended(briefFont, "Mission Briefing", titleColor);
-    int textW = tempSurf ? tempSurf->w : 0;
-    int textH = tempSurf ? tempSurf->h : 0;
-    if (tempSurf) SDL_FreeSurface(tempSurf);
+    int textW = 0, textH = 0;
+    briefText->measure("Mission Briefing", &textW, &textH);
 
     // Center vertically inside title bar
     const int briefHeight = 40;
@@ -294,13 +291,13 @@ void ChatUI::render()
         textH
     };
 
-    renderText("Mission Briefing", titleColor, titleTextRect, false, briefFont);
+    renderText("Mission Briefing", titleColor, titleTextRect, false, briefText);
 
     // SONAR SPRITE 
 
     if (sonarSprite)
     {
-        SDL_RenderCopy(renderer, sonarSprite, nullptr, &sonarRect);
+        RenderStats::copy(renderer, sonarSprite, nullptr, &sonarRect);
     }
 
 
@@ -326,10 +323,8 @@ void ChatUI::render()
     std::string nameToShow = current.sender;
 
     // Measure name width
-    SDL_Surface* nameSurf = TTF_RenderText_Blended(chatFont, nameToShow.c_str(), nameColor);
-    int nameW = nameSurf ? nameSurf->w : 0;
-    int nameH = nameSurf ? nameSurf->h : 0;
-    if (nameSurf) SDL_FreeSurface(nameSurf);
+    int nameW = 0, nameH = 0;
+    chatText->measure(nameToShow, &nameW, &nameH);
 
     // Sender name aligned to left of bubble
     int namePadding = 2;
@@ -372,7 +367,7 @@ void ChatUI::render()
             : SDL_Color{ 60, 120, 200, 250 };  // normal color
 
         SDL_SetRenderDrawColor(renderer, drawColor.r, drawColor.g, drawColor.b, drawColor.a);
-        SDL_RenderFillRect(renderer, &b.rect);
+        RenderStats::fillRect(renderer, &b.rect);
 
         SDL_Rect tr = { b.rect.x + 10, b.rect.y + 10, b.rect.w - 20, b.rect.h - 20 };
         renderText(b.text, white, tr, false);
@@ -387,7 +382,7 @@ void ChatUI::render()
         SDL_Color draw = startButtonHovered ? hover : normal;
 
         SDL_SetRenderDrawColor(renderer, draw.r, draw.g, draw.b, draw.a);
-        SDL_RenderFillRect(renderer, &startButton.rect);
+        RenderStats::fillRect(renderer, &startButton.rect);
 
         SDL_Rect tr = { startButton.rect.x + 12,
                         startButton.rect.y + 8,
@@ -403,33 +398,19 @@ void ChatUI::render()
 
 
 void ChatUI::renderText(const std::string& text, SDL_Color color,
-                        SDL_Rect& rect, bool wrap, TTF_Font* overrideFont)
+                        SDL_Rect& rect, bool wrap, TextRenderer* overrideText)
 {
     if (text.empty()) return;
 
     // Use override font if provided, else fallback to chatFont
-    TTF_Font* fontToUse = overrideFont ? overrideFont : chatFont;
-    if (!fontToUse) return;
-
-    SDL_Surface* surf = nullptr;
+    TextRenderer* textToUse = overrideText ? overrideText : chatText;
+    if (!textToUse || !textToUse->isLoaded()) return;
 
     if (wrap) {
         int wrapWidth = rect.w;
-        surf = TTF_RenderText_Blended_Wrapped(fontToUse, text.c_str(), color, wrapWidth);
+        textToUse->drawWrapped(text, rect.x, rect.y, color, wrapWidth);
     } else {
-        surf = TTF_RenderText_Blended(fontToUse, text.c_str(), color);
-    }
-
-    if (!surf) return;
-
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-    SDL_Rect dst = { rect.x, rect.y, surf->w, surf->h };
-
-    SDL_FreeSurface(surf);
-
-    if (tex) {
-        SDL_RenderCopy(renderer, tex, nullptr, &dst);
-        SDL_DestroyTexture(tex);
+        textToUse->draw(text, rect.x, rect.y, color);
     }
 }
 
@@ -440,7 +421,7 @@ void ChatUI::renderBubble(int x, int y, int w, int h, SDL_Color color)
 {
     SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
     SDL_Rect bubble = { x, y, w, h };
-    SDL_RenderFillRect(renderer, &bubble);
+    RenderStats::fillRect(renderer, &bubble);
 }
 
 int ChatUI::calculateBubbleHeight(const std::string& text, int maxWidth)
@@ -449,16 +430,8 @@ int ChatUI::calculateBubbleHeight(const std::string& text, int maxWidth)
 
     if (text.empty()) return 24;
 
-    SDL_Surface* surf =
-        TTF_RenderText_Blended_Wrapped(chatFont,
-                                       text.c_str(),
-                                       SDL_Color{255,255,255,255},
-                                       maxWidth);
-
-    if (!surf) return 40;
-
-    int h = surf->h;
-    SDL_FreeSurface(surf);
+    int w = 0, h = 0;
+    chatText->measureWrapped(text, maxWidth, &w, &h);
 
     return h + 20;
 }
@@ -526,12 +499,10 @@ void ChatUI::reset()
 
 void ChatUI::loadSonar(const std::string& sonarPath)
 {
-    SDL_Surface* sSurf = IMG_Load(sonarPath.c_str());
-    if (sSurf)
+    AssetCache::release(sonarSprite);
+    sonarSprite = AssetCache::acquireTexture(renderer, sonarPath);
+    if (sonarSprite)
     {
-        sonarSprite = SDL_CreateTextureFromSurface(renderer, sSurf);
-        SDL_FreeSurface(sSurf);
-
         const int briefHeight = 40;
 
         // WIDE SONAR SIZE
@@ -551,12 +522,6 @@ void ChatUI::loadSonar(const std::string& sonarPath)
 
 void ChatUI::loadChatBackground(const std::string& path)
 {
-    SDL_Surface* surf = IMG_Load(path.c_str());
-    if (!surf) {
-        std::cerr << "Failed to load chat background: " << IMG_GetError() << std::endl;
-        return;
-    }
-
-    chatBackground = SDL_CreateTextureFromSurface(renderer, surf);
-    SDL_FreeSurface(surf);
+    AssetCache::release(chatBackground);
+    chatBackground = AssetCache::acquireTexture(renderer, path);
 }
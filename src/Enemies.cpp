@@ -1,8 +1,8 @@
 #include "Enemies.h"
 #include <cmath>
 
-Enemies::Enemies(SDL_Texture* tex, float startX, float startY, float moveSpeed, int w, int h, int type)
-    : texture(tex), x(startX), y(startY), speed(moveSpeed), active(true), respawnTimer(0), width(w), height(h), enemyType(type)
+Enemies::Enemies(int sprite_, float startX, float startY, float moveSpeed, int w, int h, int type)
+    : x(startX), y(startY), speed(moveSpeed), width(w), height(h), enemyType(type), sprite(sprite_), active(true)
 {
     if (type == 4) {
         width = static_cast<int>(w * 1.5f);
@@ -76,7 +76,7 @@ void Enemies::update(float subX, float subY) {
     float distance = std::sqrt(dx * dx + dy * dy);
     
     // Only sharks chase the submarine when in range
-    if (enemyType == 4 && distance < detectionRadius && distance > 0) {
+    if (enemyType == 4 && distance < DETECTION_RADIUS && distance > 0) {
         float dirX = dx / distance;
         float dirY = dy / distance;
         
@@ -103,37 +103,10 @@ void Enemies::update(float subX, float subY) {
     }
 }
 
-void Enemies::render(SDL_Renderer* renderer) {
-    if (!active) return;
-    
-    // Blink red if recently hit 
-    if (hitBlinkTimer > 0 && (hitBlinkTimer / 3) % 2 == 0) {
-        SDL_SetTextureColorMod(texture, 255, 100, 100);  // Red tint
-    } else {
-        SDL_SetTextureColorMod(texture, 255, 255, 255);  // Normal color (if not hit)
-    }
-    
-    SDL_Rect dest = { static_cast<int>(x), static_cast<int>(y), width, height };
-    
-    // Flip shark sprite based on facing direction
-    if (enemyType == 4) {
-        SDL_RendererFlip flip = facingRight ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
-        SDL_RenderCopyEx(renderer, texture, nullptr, &dest, 0, nullptr, flip);
-    } else {
-        SDL_RenderCopy(renderer, texture, nullptr, &dest);
-    }
-    
-    // Reset color mod
-    SDL_SetTextureColorMod(texture, 255, 255, 255);
-}
-
-bool Enemies::checkCollision(const SDL_Rect& subRect) {
+bool Enemies::checkCollision(const SimRect& subRect) {
     if (!active) return false;
-    SDL_Rect enemiesRect = { static_cast<int>(x), static_cast<int>(y), width, height };
-    return (subRect.x < enemiesRect.x + enemiesRect.w &&
-            subRect.x + subRect.w > enemiesRect.x &&
-            subRect.y < enemiesRect.y + enemiesRect.h &&
-            subRect.y + subRect.h > enemiesRect.y);
+    SimRect enemiesRect = { static_cast<int>(x), static_cast<int>(y), width, height };
+    return rectsOverlap(subRect, enemiesRect);
 }
 
 void Enemies::startHitBlink() {
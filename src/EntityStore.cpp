@@ -0,0 +1,87 @@
+#include "EntityStore.h"
+
+void EntityStore::reserve(int capacity) {
+    maxCount = capacity;
+    x.reserve(capacity);
+    y.reserve(capacity);
+    speed.reserve(capacity);
+    width.reserve(capacity);
+    height.reserve(capacity);
+    sprite.reserve(capacity);
+    flags.reserve(capacity);
+}
+
+void EntityStore::clear() {
+    x.clear();
+    y.clear();
+    speed.clear();
+    width.clear();
+    height.clear();
+    sprite.clear();
+    flags.clear();
+}
+
+int EntityStore::add(int spriteId, float startX, float startY, float moveSpeed, int w, int h) {
+    if (full()) return -1;
+
+    x.push_back(startX);
+    y.push_back(startY);
+    speed.push_back(moveSpeed);
+    width.push_back(w);
+    height.push_back(h);
+    sprite.push_back(spriteId);
+    flags.push_back(FLAG_ACTIVE);
+    return size() - 1;
+}
+
+void EntityStore::remove(int index) {
+    int last = size() - 1;
+    if (index < 0 || index > last) return;
+
+    if (index != last) {
+        x[index] = x[last];
+        y[index] = y[last];
+        speed[index] = speed[last];
+        width[index] = width[last];
+        height[index] = height[last];
+        sprite[index] = sprite[last];
+        flags[index] = flags[last];
+    }
+    x.pop_back();
+    y.pop_back();
+    speed.pop_back();
+    width.pop_back();
+    height.pop_back();
+    sprite.pop_back();
+    flags.pop_back();
+}
+
+void EntityStore::removeInactive() {
+    for (int i = 0; i < size();) {
+        if (flags[i] & FLAG_ACTIVE) {
+            i++;
+        } else {
+            remove(i);  // Whatever got swapped in is checked next
+        }
+    }
+}
+
+// The passes below are straight loops with no branches, so they
+// vectorize (check with -O3 -fopt-info-vec).
+
+void EntityStore::driftLeft(int begin, int end) {
+    float* px = x.data();
+    const float* ps = speed.data();
+    for (int i = begin; i < end; i++) {
+        px[i] -= ps[i];
+    }
+}
+
+void EntityStore::deactivateLeftOf(float minX, int begin, int end) {
+    const float* px = x.data();
+    uint8_t* pf = flags.data();
+    for (int i = begin; i < end; i++) {
+        uint8_t clearMask = px[i] < minX ? uint8_t(~FLAG_ACTIVE) : uint8_t(0xFF);
+        pf[i] &= clearMask;
+    }
+}
@@ -0,0 +1,89 @@
+#include "FontManager.h"
+#include "GlyphAtlas.h"
+#include "Profiler.h"
+#include <iostream>
+
+bool FontManager::initialized = false;
+
+std::map<FontManager::FontKey, TTF_Font*>& FontManager::fonts() {
+    static std::map<FontKey, TTF_Font*> registry;
+    return registry;
+}
+
+std::map<TTF_Font*, GlyphAtlas*>& FontManager::atlases() {
+    static std::map<TTF_Font*, GlyphAtlas*> registry;
+    return registry;
+}
+
+bool FontManager::init() {
+    if (initialized) return true;
+
+    if (TTF_Init() < 0) {
+        std::cerr << "SDL_ttf init failed: " << TTF_GetError() << std::endl;
+        return false;
+    }
+    initialized = true;
+    return true;
+}
+
+void FontManager::shutdown() {
+    // Anything still here lost its texture along with the renderer
+    for (auto& entry : atlases()) {
+        entry.second->texture = nullptr;
+        delete entry.second;
+    }
+    atlases().clear();
+
+    for (auto& entry : fonts()) {
+        if (entry.second) TTF_CloseFont(entry.second);
+    }
+    fonts().clear();
+
+    if (initialized) {
+        TTF_Quit();
+        initialized = false;
+    }
+}
+
+TTF_Font* FontManager::get(const std::string& path, int size) {
+    FontKey key(path, size);
+    auto it = fonts().find(key);
+    if (it != fonts().end()) {
+        return it->second;
+    }
+
+    if (!initialized && !init()) {
+        return nullptr;
+    }
+
+    PROFILE_ZONE("FontManager::load");
+
+    // Failed loads are cached too so we only report them once
+    TTF_Font* font = TTF_OpenFont(path.c_str(), size);
+    if (!font) {
+        std::cerr << "Failed to load font " << path << " (" << size << "pt): "
+                  << TTF_GetError() << std::endl;
+    }
+    fonts()[key] = font;
+    return font;
+}
+
+const GlyphAtlas* FontManager::getAtlas(SDL_Renderer* renderer, TTF_Font* font) {
+    if (!font) return nullptr;
+
+    auto it = atlases().find(font);
+    if (it != atlases().end()) {
+        return it->second;
+    }
+
+    GlyphAtlas* atlas = new GlyphAtlas(renderer, font);
+    atlases()[font] = atlas;
+    return atlas;
+}
+
+void FontManager::releaseAtlases() {
+    for (auto& entry : atlases()) {
+        delete entry.second;
+    }
+    atlases().clear();
+}
@@ -0,0 +1,75 @@
+#include "FramePipeline.h"
+#include "Profiler.h"
+#include "RenderStats.h"
+
+FramePipeline::FramePipeline()
+    : front(0),
+      replayMs(0.0),
+      presentMs(0.0),
+      job(nullptr),
+      stopping(false)
+{
+    worker = std::thread(&FramePipeline::workerLoop, this);
+}
+
+FramePipeline::~FramePipeline() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobReady.notify_all();
+    worker.join();
+}
+
+void FramePipeline::runFrame(SDL_Renderer* renderer, const std::function<void()>& build) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &build;
+    }
+    jobReady.notify_one();
+
+    // Draw last frame's list meanwhile
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (!lists[front].empty()) {
+        PROFILE_ZONE("RenderList::replay");
+        lists[front].replay(renderer);
+    }
+    Uint64 replayed = SDL_GetPerformanceCounter();
+    if (!lists[front].empty()) {
+        // Blocks on vsync; the worker keeps going
+        PROFILE_ZONE("SDL_RenderPresent");
+        SDL_RenderPresent(renderer);
+    }
+    Uint64 presented = SDL_GetPerformanceCounter();
+    replayMs = double(replayed - start) * 1000.0 / double(frequency);
+    presentMs = double(presented - replayed) * 1000.0 / double(frequency);
+
+    {
+        PROFILE_ZONE("Wait for frame");
+        std::unique_lock<std::mutex> lock(mutex);
+        jobDone.wait(lock, [this] { return job == nullptr; });
+    }
+    front = 1 - front;
+}
+
+void FramePipeline::workerLoop() {
+    PROFILE_THREAD_NAME("Simulation");
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        jobReady.wait(lock, [this] { return stopping || job != nullptr; });
+        if (stopping) return;
+        lock.unlock();
+
+        // The back list: nobody else touches it until runFrame() swaps
+        RenderList& list = lists[1 - front];
+        list.reset();
+        RenderStats::record(&list);
+        (*job)();
+        RenderStats::record(nullptr);
+
+        lock.lock();
+        job = nullptr;
+        jobDone.notify_one();
+    }
+}
@@ -9,39 +9,63 @@
 #include "GameOverScreen.h"
 #include "Messages.h" 
 #include "StoryManager.h"
-
-// Helper to load textures (copied from original main)
-static SDL_Texture* loadTexture(SDL_Renderer* renderer, const char* path) {
-    SDL_Surface* surf = IMG_Load(path);
-    if (!surf) {
-        std::cerr << "Failed to load image: " << path << " | " << IMG_GetError() << std::endl;
-        return nullptr;
+#include "FontManager.h"
+#include "RenderStats.h"
+#include "Profiler.h"
+#include "Autopilot.h"
+#include "FramePipeline.h"
+#include "JobPool.h"
+#include "AssetCache.h"
+
+// Background image for each level
+static const char* backgroundPath(int level) {
+    switch (level) {
+        case 1: return "Assets/backgrounds/Level1.png";
+        case 2: return "Assets/backgrounds/Level2.png";
+        case 3: return "Assets/backgrounds/Level3.png";
+        default: return "Assets/backgrounds/Level4.png";
     }
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-    SDL_FreeSurface(surf);
-    return tex;
 }
 
+// Start decoding the next background this many points before the level ends
+static const int PREFETCH_SCORE_MARGIN = 30;
+
+// Autopilot soak runs print a status line this often (wall clock)
+static const int SOAK_LOG_SECONDS = 60;
+
 GameManager::GameManager(SDL_Window* window_, SDL_Renderer* renderer_)
     : window(window_),
       renderer(renderer_),
-      level(nullptr),
-      submarine(nullptr),
+      sim(nullptr),
+      spriteAtlas(nullptr),
+      levelRenderer(nullptr),
+      introText(nullptr),
+      assetLoader(nullptr),
+      perfHud(nullptr),
+      recording(nullptr),
+      replay(nullptr),
+      autopilot(false),
+      uncapped(false),
       scoreboard(nullptr),
       messages(nullptr),
       menu(nullptr),
       running(true),
       startGame(false),
+      ocean(nullptr),
+      retiredOcean(nullptr),
+      pauseBG(nullptr),
+      gameOverBG(nullptr),
       backgroundMusic(nullptr),
+      timerSound(nullptr),
       levelCompleteSound(nullptr),   
-      animalCollisionSound(nullptr), 
-      showingLevel4Intro(false),
-      level4IntroTimer(0),
-      level4IntroBlinkCounter(0)
+      animalCollisionSound(nullptr),
+      victorySound(nullptr)
 {
     // Create menu 
     menu = new Menu(renderer);
 
+    assetLoader = new AssetLoader();
+
     // Initialize upgraded Messages system
     msgManager = new Messages(renderer);
     storyManager = new StoryManager(msgManager);
@@ -68,14 +92,38 @@ GameManager::GameManager(SDL_Window* window_, SDL_Renderer* renderer_)
 
 GameManager::~GameManager() {
 
-    if (level) {
-        delete level;
-        level = nullptr;
+    if (levelRenderer) {
+        delete levelRenderer;
+        levelRenderer = nullptr;
+    }
+
+    delete introText;
+    introText = nullptr;
+
+    delete perfHud;
+    perfHud = nullptr;
+
+    if (recording) {
+        if (recording->save(recordPath)) {
+            std::cout << "Recorded " << recording->getTickCount() << " ticks to " << recordPath << std::endl;
+        } else {
+            std::cerr << "Failed to write recording: " << recordPath << std::endl;
+        }
+        delete recording;
+        recording = nullptr;
     }
+    delete replay;
+    replay = nullptr;
+
+    delete spriteAtlas;
+    spriteAtlas = nullptr;
+
+    delete assetLoader;
+    assetLoader = nullptr;
 
-    if (submarine) {
-        delete submarine;
-        submarine = nullptr;
+    if (sim) {
+        delete sim;
+        sim = nullptr;
     }
 
     if (scoreboard) {
@@ -98,34 +146,85 @@ GameManager::~GameManager() {
         menu = nullptr;
     }
 
+    // Textures and sounds stay in AssetCache for the next game
+    AssetCache::release(retiredOcean);
+    AssetCache::release(ocean);
+    AssetCache::release(pauseBG);
+    AssetCache::release(gameOverBG);
+
     if (backgroundMusic) {
         Mix_HaltMusic();
-        Mix_FreeMusic(backgroundMusic);
+        AssetCache::release(backgroundMusic);
         backgroundMusic = nullptr;
     }
-    if (timerSound) {
-        Mix_FreeChunk(timerSound);
-        timerSound = nullptr;
-    }
+    AssetCache::release(timerSound);
+    AssetCache::release(levelCompleteSound);
+    AssetCache::release(animalCollisionSound);
+    AssetCache::release(victorySound);
+}
 
-    if (levelCompleteSound) {
-        Mix_FreeChunk(levelCompleteSound);
-        levelCompleteSound = nullptr;
+
+
+void GameManager::recordTo(const std::string& path) {
+    recordPath = path;
+}
+
+bool GameManager::replayFrom(const std::string& path) {
+    InputRecording* loaded = new InputRecording();
+    if (!loaded->load(path)) {
+        std::cerr << "Failed to load replay: " << path << std::endl;
+        delete loaded;
+        return false;
+    }
+    delete replay;
+    replay = loaded;
+    startGame = true;  // Straight into the game, skip the menu
+    return true;
+}
+
+void GameManager::setAutopilot(bool uncapped_) {
+    autopilot = true;
+    uncapped = uncapped_;
+    startGame = true;  // Nobody to click Play
+}
+
+void GameManager::stopReplay() {
+    if (!replay) return;
+    std::cout << "Replay finished, you have control" << std::endl;
+    delete replay;
+    replay = nullptr;
+}
+
+// Menu screens return "resume"/"restart"/"menu"/"exit". A replay supplies
+// the recorded choice instead of showing the screen.
+std::string GameManager::runScreen(InputRecording::Screen screen, const std::function<std::string()>& show) {
+    static const char* choiceNames[] = { "resume", "restart", "menu", "exit" };
+
+    if (replay) {
+        InputRecording::Choice choice;
+        if (replay->takeScreen(screen, choice) && choice <= InputRecording::CHOICE_EXIT) {
+            return choiceNames[choice];
+        }
+        stopReplay();  // Out of input (or out of sync): the player takes over
     }
 
-    if (animalCollisionSound) {
-        Mix_FreeChunk(animalCollisionSound);
-        animalCollisionSound = nullptr;
+    // The autopilot never stops: straight into the next game
+    std::string result;
+    if (autopilot && (screen == InputRecording::SCREEN_GAME_OVER || screen == InputRecording::SCREEN_VICTORY)) {
+        result = "restart";
+    } else {
+        result = show();
     }
-    
-    if (victorySound) {
-        Mix_FreeChunk(victorySound);
-        victorySound = nullptr;
+    if (recording) {
+        for (int i = 0; i <= InputRecording::CHOICE_EXIT; i++) {
+            if (result == choiceNames[i]) {
+                recording->addScreen(screen, InputRecording::Choice(i));
+            }
+        }
     }
+    return result;
 }
 
-
-
 void GameManager::run() {
     while (running && !startGame) {
         SDL_Event e;
@@ -143,44 +242,36 @@ void GameManager::run() {
     // Stop menu music and load game music
     Mix_HaltMusic();
     
-    // Load level complete sound effect
-    levelCompleteSound = Mix_LoadWAV("Assets/sound_effects/level_complete1.wav");
-    if (!levelCompleteSound) {
-        std::cerr << "Failed to load level complete sound! Mix_Error: " << Mix_GetError() << std::endl;
-    } else {
+    // Sounds and music come from AssetCache: only the first game reads
+    // them from disk, later ones get the same chunks back.
+
+    // Level complete sound effect
+    levelCompleteSound = AssetCache::acquireChunk("Assets/sound_effects/level_complete1.wav");
+    if (levelCompleteSound) {
         Mix_VolumeChunk(levelCompleteSound, MIX_MAX_VOLUME / 8);  // Set volume
     }
     
-    // Load animal collision sound effect
-    animalCollisionSound = Mix_LoadWAV("Assets/sound_effects/animal_collision9.wav");
-    if (!animalCollisionSound) {
-        std::cerr << "Failed to load animal collision sound! Mix_Error: " << Mix_GetError() << std::endl;
-    } else {
+    // Animal collision sound effect
+    animalCollisionSound = AssetCache::acquireChunk("Assets/sound_effects/animal_collision9.wav");
+    if (animalCollisionSound) {
         Mix_VolumeChunk(animalCollisionSound, MIX_MAX_VOLUME / 4);  // Set volume
     }
     
-    // Load victory sound effect
-    victorySound = Mix_LoadWAV("Assets/sound_effects/victory.wav");
-    if (!victorySound) {
-        std::cerr << "Failed to load victory sound! Mix_Error: " << Mix_GetError() << std::endl;
-    } else {
+    // Victory sound effect
+    victorySound = AssetCache::acquireChunk("Assets/sound_effects/victory.wav");
+    if (victorySound) {
         Mix_VolumeChunk(victorySound, MIX_MAX_VOLUME);  // Set volume
     }
     
-    // Load game background music
-    backgroundMusic = Mix_LoadMUS("Assets/music/beach-house-tune-144457.mp3");
+    // Game background music
+    backgroundMusic = AssetCache::acquireMusic("Assets/music/beach-house-tune-144457.mp3");
     if (!backgroundMusic) {
-        backgroundMusic = Mix_LoadMUS("Assets/music/beach-house-tune-144457.wav");
-        if (!backgroundMusic) {
-            std::cerr << "Failed to load game music! Mix_Error: " << Mix_GetError() << std::endl;
-        }
+        backgroundMusic = AssetCache::acquireMusic("Assets/music/beach-house-tune-144457.wav");
     }
     
-    // Load 10-second timer sound for Level 4
-    timerSound = Mix_LoadWAV("Assets/sound_effects/timer_10s.mp3");
-    if (!timerSound) {
-        std::cerr << "Failed to load timer sound! Mix_Error: " << Mix_GetError() << std::endl;
-    } else {
+    // 10-second timer sound for Level 4
+    timerSound = AssetCache::acquireChunk("Assets/sound_effects/timer_10s.mp3");
+    if (timerSound) {
         Mix_VolumeChunk(timerSound, MIX_MAX_VOLUME / 4);  // Set volume
     }
     
@@ -192,542 +283,573 @@ void GameManager::run() {
 
 
     // Load shared textures
-    SDL_Texture* ocean = loadTexture(renderer, "Assets/backgrounds/Level1.png");
-    SDL_Texture* submarineTex = loadTexture(renderer, "Assets/submarine.png");
-    if (!ocean || !submarineTex) {
+    ocean = AssetCache::acquireTexture(renderer, backgroundPath(1));
+    SDL_Surface* submarineImg = AssetCache::acquireImage("Assets/submarine.png");
+    if (!ocean || !submarineImg) {
         std::cerr << "Missing textures! Place Level1.png and submarine.png in /assets\n";
+        AssetCache::release(submarineImg);
         return;
     }
 
     // Pause + Game Over Backgrounds
-    SDL_Texture* pauseBG = loadTexture(renderer, "Assets/backgrounds/gameover_bg.png");
-    SDL_Texture* gameOverBG = loadTexture(renderer, "Assets/backgrounds/gameover_bg.png");
-
-    //Radio textures
-    SDL_Texture* radioTex = loadTexture(renderer, "Assets/Radio.png");
-
-    // Litter textures
-    SDL_Texture* canTex = loadTexture(renderer, "Assets/can.png");
-    SDL_Texture* bottleTex = loadTexture(renderer, "Assets/bottle.png");
-    SDL_Texture* bagTex = loadTexture(renderer, "Assets/bag.png");
-    SDL_Texture* cupTex = loadTexture(renderer, "Assets/cup.png");
-    SDL_Texture* colaTex = loadTexture(renderer, "Assets/cola.png");
-    SDL_Texture* smallcanTex = loadTexture(renderer, "Assets/smallcan.png");
-    SDL_Texture* beerTex = loadTexture(renderer, "Assets/beer.png");
-
-    // Enemy textures
-    SDL_Texture* swordfishTexture = loadTexture(renderer, "Assets/Swordfish.png");
-    SDL_Texture* eelTexture = loadTexture(renderer, "Assets/Eel.png");
-    SDL_Texture* octopusTexture = loadTexture(renderer, "Assets/Octopus.png");
-    SDL_Texture* anglerTexture = loadTexture(renderer, "Assets/Angler.png");
-    SDL_Texture* sharkTexture = loadTexture(renderer, "Assets/Shark.png");
-
-    std::vector<SDL_Texture*> enemyTextures = { swordfishTexture, eelTexture, octopusTexture, anglerTexture, sharkTexture };
-    std::vector<float> enemySpeeds = { 6.0f, 6.0f, 6.0f, 6.0f, 4.0f };
-    std::vector<int> enemyWidths = { 70, 70, 60, 60, 60 };    // Swordfish, Eel, Octopus, Angler, Shark widths
-    std::vector<int> enemyHeights = { 50, 30, 60, 55, 40 };   // Swordfish, Eel, Octopus, Angler, Shark heights
-
-    SDL_Texture* heartTex = loadTexture(renderer, "Assets/heart.png");
-    SDL_Texture* oilTex = loadTexture(renderer, "Assets/oil.png");
+    pauseBG = AssetCache::acquireTexture(renderer, "Assets/backgrounds/gameover_bg.png");
+    gameOverBG = AssetCache::acquireTexture(renderer, "Assets/backgrounds/gameover_bg.png");
+
+    // Sprite images, indexed by sprite ID. This game only holds them until
+    // the atlas is built; the cache keeps them decoded for the next one.
+    const char* spritePaths[SPRITE_COUNT] = {};
+    spritePaths[SPRITE_CAN] = "Assets/can.png";
+    spritePaths[SPRITE_BOTTLE] = "Assets/bottle.png";
+    spritePaths[SPRITE_BAG] = "Assets/bag.png";
+    spritePaths[SPRITE_CUP] = "Assets/cup.png";
+    spritePaths[SPRITE_COLA] = "Assets/cola.png";
+    spritePaths[SPRITE_SMALLCAN] = "Assets/smallcan.png";
+    spritePaths[SPRITE_BEER] = "Assets/beer.png";
+    spritePaths[SPRITE_SWORDFISH] = "Assets/Swordfish.png";
+    spritePaths[SPRITE_EEL] = "Assets/Eel.png";
+    spritePaths[SPRITE_OCTOPUS] = "Assets/Octopus.png";
+    spritePaths[SPRITE_ANGLER] = "Assets/Angler.png";
+    spritePaths[SPRITE_SHARK] = "Assets/Shark.png";
+    spritePaths[SPRITE_HEART] = "Assets/heart.png";
+    spritePaths[SPRITE_OIL] = "Assets/oil.png";
+
+    std::vector<SDL_Surface*> spriteImages(SPRITE_COUNT, nullptr);
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        if (i == SPRITE_SUBMARINE) continue;
+        spriteImages[i] = AssetCache::acquireImage(spritePaths[i]);
+    }
+    spriteImages[SPRITE_SUBMARINE] = submarineImg;
 
     // Scoreboard
     scoreboard = new Scoreboard(renderer, 650, 10, 140, 80);
     scoreboard->setScore(0);
 
+    // Entity sizes come from the loaded textures
+    SimConfig simConfig;
+    for (int i = 0; i < LITTER_TYPE_COUNT; i++) {
+        SDL_Surface* img = spriteImages[SPRITE_CAN + i];
+        int w = img ? img->w : 0;
+        int h = img ? img->h : 0;
+
+        // Scale down here if you want universal smaller sizes
+        float litterScale = 0.15f;
+        simConfig.litterWidths[i] = int(w * litterScale);
+        simConfig.litterHeights[i] = int(h * litterScale);
+    }
+
     // Submarine
-    int texW, texH;
-    SDL_QueryTexture(submarineTex, nullptr, nullptr, &texW, &texH);
+    int texW = submarineImg->w;
+    int texH = submarineImg->h;
 
     // Scale tuned for your scene
     float scale = 0.11f;
 
-    int subW = (int)(texW * scale);
-    int subH = (int)(texH * scale);
-
-    submarine = new Submarine(submarineTex, 200, 275, subW, subH);
+    simConfig.submarineWidth = (int)(texW * scale);
+    simConfig.submarineHeight = (int)(texH * scale);
 
+    // Pack every sprite at the size it's drawn at. Enemies and the submarine
+    // also get flipped/red copies for facing and hit-blink.
+    spriteAtlas = new SpriteAtlas(renderer);
+    for (int i = 0; i < LITTER_TYPE_COUNT; i++) {
+        spriteAtlas->add(SPRITE_CAN + i, spriteImages[SPRITE_CAN + i],
+                         simConfig.litterWidths[i], simConfig.litterHeights[i], false);
+    }
+    for (int i = 0; i < ENEMY_TYPE_COUNT; i++) {
+        spriteAtlas->add(SPRITE_SWORDFISH + i, spriteImages[SPRITE_SWORDFISH + i],
+                         simConfig.enemyWidths[i], simConfig.enemyHeights[i], true);
+    }
+    spriteAtlas->add(SPRITE_SUBMARINE, submarineImg, simConfig.submarineWidth, simConfig.submarineHeight, true);
+    spriteAtlas->add(SPRITE_HEART, spriteImages[SPRITE_HEART], 40, 35, false);
+    spriteAtlas->add(SPRITE_OIL, spriteImages[SPRITE_OIL], 400, 400, false);  // Ink spots are 250-400px
+    spriteAtlas->build();
 
+    for (SDL_Surface* img : spriteImages) {
+        AssetCache::release(img);
+    }
 
-    // Level: Start with Level1 (no animals)
-    level = new Level1(renderer,
-                       { canTex, bottleTex, bagTex, cupTex, colaTex, smallcanTex, beerTex },
-                       enemyTextures, enemySpeeds, enemyWidths, enemyHeights);
-    
-    storyManager->setLevelPointer(level);
+    // All of the simulation's randomness comes from this seed, so the
+    // seed plus the inputs replay a session exactly
+    uint32_t seed = replay ? replay->getSeed() : static_cast<uint32_t>(time(nullptr));
+    if (!recordPath.empty()) {
+        recording = new InputRecording(seed);
+    }
 
-    // Set oil texture for level 3 blackout effect
-    level->setOilTexture(oilTex);
-    level->setAnimalCollisionSound(animalCollisionSound);
+    // Simulation starts with Level1 (no animals)
+    sim = new Simulation(simConfig, seed);
+    levelRenderer = new LevelRenderer(renderer, *spriteAtlas);
+    introText = new TextRenderer(renderer, FontManager::get(UI_FONT_PATH, 32));
+    perfHud = new PerfHud(renderer);
 
+    storyManager->loadFont(renderer);
+    storyManager->setLevelPointer(&sim->getLevel());
     storyManager->onLevelChange(1);
 
     // Game state
-    int lives = 3;
-    bool gameOver = false;
     float cameraX = 0.0f;
     const float scrollSpeed = 2.0f;
     const int bgWidth = 800;
     const int bgHeight = 600;
 
-    int currentLevel = scoreboard->getLevel();
+    int currentLevel = sim->getLevelNumber();
+
+    // Soak stats (autopilot)
+    long long ticksRun = 0;
+    int gamesStarted = 1;
+
+    // Big entity passes get split across cores. Only the pipeline's worker
+    // ticks, so it's the pool's one caller. Normal levels stay under the
+    // grain and run inline.
+    JobPool jobPool;
+    sim->setJobPool(&jobPool);
+
+    // Each frame is ticked and recorded on the pipeline's worker while this
+    // thread draws the one before it (see FramePipeline). Textures are only
+    // created and destroyed here, between frames.
+    FramePipeline pipeline;
+    int oceanLevel = 1;   // Level the ocean texture is for
 
     // Reset function
     auto resetGame = [&]() {
+        gamesStarted++;
         storyManager->onLevelChange(1);
         msgManager->reset();
         msgManager->update();
 
-        lives = 3;
-        gameOver = false;
-        submarine->setPosition(200, 275);
-        submarine->reset();
+        sim->reset();
+        storyManager->setLevelPointer(&sim->getLevel());
+
         scoreboard->setScore(0);
         scoreboard->resetLevel();
         cameraX = 0.0f;
         currentLevel = 1;
         
-        // Destroy old level and recreate as Level1
-        delete level;
-        level = new Level1(renderer,
-                          { canTex, bottleTex, bagTex, cupTex, colaTex, smallcanTex, beerTex },
-                          enemyTextures, enemySpeeds, enemyWidths, enemyHeights);
-       
-       storyManager->setLevelPointer(level);
-       level->setOilTexture(oilTex);
-       level->setAnimalCollisionSound(animalCollisionSound);
-        
-        // Reset ocean background to level 1
-        SDL_DestroyTexture(ocean);
-        ocean = loadTexture(renderer, "Assets/backgrounds/Level1.png");
-        
-        // Recreate Level 1 to properly reset all state
-        delete level;
-        level = new Level1(renderer,
-                           { canTex, bottleTex, bagTex, cupTex, colaTex, smallcanTex, beerTex },
-                           enemyTextures, enemySpeeds, enemyWidths, enemyHeights);
-        
-        storyManager->setLevelPointer(level);
-
-        level->setOilTexture(oilTex);
-        level->setAnimalCollisionSound(animalCollisionSound);
+        // Back to the level 1 ocean. The frame waiting to be drawn shows the
+        // old game, so drop it along with the textures it uses. Every
+        // background stays resident in AssetCache, so this is a lookup.
+        pipeline.discard();
+        AssetCache::release(retiredOcean);
+        retiredOcean = nullptr;
+        if (oceanLevel != 1) {
+            AssetCache::release(ocean);
+            ocean = AssetCache::acquireTexture(renderer, backgroundPath(1));
+            oceanLevel = 1;
+        }
 
-        // Reset music to start from the beginning
+        // Music from the beginning: just a seek if it's still going
+        // (victory stops it, so then it's started again)
         if (backgroundMusic) {
-            Mix_RewindMusic();
-            Mix_PlayMusic(backgroundMusic, -1);
+            if (Mix_PlayingMusic()) {
+                Mix_RewindMusic();
+            } else {
+                Mix_PlayMusic(backgroundMusic, -1);
+            }
             Mix_VolumeMusic(MIX_MAX_VOLUME / 2);
         }
     };
 
     SDL_Event event;
-    srand(static_cast<unsigned int>(time(nullptr)));
-
-    // Frame timing for accurate updates
-    Uint32 lastTime = SDL_GetTicks();
-
-    // Main loop
-    while (running) {
-        while (SDL_PollEvent(&event)) {
-    if (event.type == SDL_QUIT) {
-        running = false;
-    }
-
-    //AUTO V ICTORY SCENE (for demo purposes)
-
-    // Press V to trigger the victory screen instantly 
-    if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_v) {
-
-        // Stop all gameplay audio
-        Mix_HaltMusic();
-        if (victorySound) {
-            Mix_PlayChannel(-1, victorySound, 0);
-        }
-
-        VictoryScreen vs(renderer);
 
-        // Show victory screen immediately with your real facts & score
-        std::string result = vs.run(scoreboard->getScore());
-
-
-        if (result == "restart") {
-            resetGame();
-            continue;
-        }
-        if (result == "menu") {
-            resetGame();
-            startGame = false;
-            return;
-        }
-        if (result == "exit") {
-            running = false;
-            break;
-        }
-    }
-
-    // PAUSE MENU (ESC)
-    if (!gameOver && event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE) {
-
-        GameOverScreen pause(renderer, pauseBG);
-
-        int factIndex = currentLevel - 1;
-        if (factIndex < 0) factIndex = 0;
-        if (factIndex >= facts.size()) factIndex = facts.size() - 1;
-
-        std::string action = pause.run("Paused", facts);
-
-        if (action == "resume") { 
-            continue;   // resume
-    }
+    // Fixed timestep: the simulation always ticks at 60 Hz (all gameplay
+    // timers are in frames), rendering happens once per loop at vsync rate
+    const double tickSeconds = 1.0 / 60.0;
+    const int maxTicksPerFrame = 5;  // Catch-up cap so a stall can't snowball
+    const Uint64 perfFrequency = SDL_GetPerformanceFrequency();
+    Uint64 lastCounter = SDL_GetPerformanceCounter();
+    double accumulator = 0.0;
+    auto msSince = [perfFrequency](Uint64 start) {
+        return double(SDL_GetPerformanceCounter() - start) * 1000.0 / double(perfFrequency);
+    };
+    const Uint64 runStart = SDL_GetPerformanceCounter();
+    Uint64 nextSoakLog = runStart + perfFrequency * SOAK_LOG_SECONDS;
+
+    // One line per minute so a 24 hour run shows memory growth and
+    // frame-time drift (entity counts, textures, frame percentiles)
+    auto logSoakStats = [&]() {
+        const Level& level = sim->getLevel();
+        int oilSpots = int(level.getOilSpots().size());
+        std::cout << "[soak] " << msSince(runStart) / 1000.0 << " s"
+                  << " ticks " << ticksRun
+                  << " games " << gamesStarted
+                  << " level " << currentLevel
+                  << " | frame p50 " << perfHud->frameTimePercentile(50)
+                  << " ms p99 " << perfHud->frameTimePercentile(99) << " ms"
+                  << " | litter " << level.getLitterItems().size()
+                  << " flow " << level.getLitterFlow().size()
+                  << " animals " << level.getEnemyItems().size()
+                  << " ink " << oilSpots
+                  << " | textures " << RenderStats::getTextureCount()
+                  << " (" << RenderStats::getTextureBytes() / (1024.0 * 1024.0) << " MB)"
+                  << std::endl;
+    };
 
-        if (action == "restart") {
-            resetGame();
-            continue;   // restart
+    SimInput keyboard;     // Sampled on this thread before each frame
+    double simMs = 0.0;
+    double recordMs = 0.0;
+
+    // Runs on the pipeline's worker: tick the simulation, then record the
+    // frame. Draws go through RenderStats into the pipeline's back list.
+    std::function<void()> buildFrame = [&]() {
+        RenderStats::beginFrame();
+
+        // Accumulate real time and run as many fixed ticks as it covers
+        Uint64 nowCounter = SDL_GetPerformanceCounter();
+        accumulator += double(nowCounter - lastCounter) / double(perfFrequency);
+        lastCounter = nowCounter;
+        if (accumulator > tickSeconds * maxTicksPerFrame) {
+            accumulator = tickSeconds * maxTicksPerFrame;
         }
-        if (action == "menu") {
-            resetGame();
-            startGame = false;
-            return;   // go back to main menu
+        if (uncapped) {
+            accumulator = tickSeconds;  // One tick per frame, however fast frames come
         }
-        if (action == "exit") {
-            running = false;
-            break;
-        }
-    }
-}
 
-        if (!gameOver) {
-            // Keyboard input
-            const Uint8* keys = SDL_GetKeyboardState(NULL);
-            
-            // Check if submarine is in blackout to slow movement (only for Level3)
-            SDL_Rect subRect = submarine->getRect();
-            int subCenterX = subRect.x + subRect.w / 2;
-            int subCenterY = subRect.y + subRect.h / 2;
-            bool inBlackout = false;
-            Level3* level3 = dynamic_cast<Level3*>(level);
-            if (level3) {
-                inBlackout = level3->isPositionInBlackout(subCenterX, subCenterY);
-            }
-            int moveSpeed = inBlackout ? 2 : 5; // Slow movement in blackout
-            
-            if (keys[SDL_SCANCODE_UP])    submarine->moveBy(0, -moveSpeed);
-            if (keys[SDL_SCANCODE_DOWN])  submarine->moveBy(0, moveSpeed);
-            if (keys[SDL_SCANCODE_LEFT])  submarine->moveBy(-moveSpeed, 0);
-            if (keys[SDL_SCANCODE_RIGHT]) submarine->moveBy(moveSpeed, 0);
-            
-            // Calm ability with SPACE 
-            if (keys[SDL_SCANCODE_SPACE]) {
-                float subX = subRect.x + subRect.w / 2.0f;
-                float subY = subRect.y + subRect.h / 2.0f;
-                level->calmEnemies(subX, subY, 150.0f);  // 150 pixel radius
-            }
+        Uint64 simStart = SDL_GetPerformanceCounter();
+        while (accumulator >= tickSeconds) {
+            PROFILE_ZONE("Tick");
+            accumulator -= tickSeconds;
+
+            if (!sim->isGameOver()) {
+                if (replay && !replay->nextIsTick()) {
+                    if (replay->nextIsScreen(InputRecording::SCREEN_PAUSE) ||
+                        replay->nextIsScreen(InputRecording::SCREEN_VICTORY_KEY)) {
+                        // A menu was opened here; it comes up next frame
+                        accumulator = 0.0;
+                        break;
+                    }
+                    stopReplay();
+                }
 
-            submarine->clamp(50, 650, 0, 540);
+                SimInput input;
+                if (replay) {
+                    input = replay->takeTick();
+                } else if (autopilot) {
+                    input = Autopilot::decide(*sim);
+                } else {
+                    input = keyboard;
+                }
+                if (recording) {
+                    recording->addTick(input);
+                }
 
-            // Update submarine blink effect
-            submarine->updateBlink();
+                sim->step(input);
+                ticksRun++;
+                scoreboard->setScore(sim->getScore());
 
-            // Level 4 intro sequence - pause gameplay
-            if (showingLevel4Intro) {
-                level4IntroTimer++;
-                level4IntroBlinkCounter++;
-                
-                // End intro after 3 seconds 
-                if (level4IntroTimer >= 180) {
-                    showingLevel4Intro = false;
-                    timerMusicPlayed = false;  // Reset timer music flag for Level 4
-                }
-            } else {
-                // Normal gameplay - update level
-                level->update(*submarine, *scoreboard, lives, gameOver);
-                
-                // Check if we're in Level 4 and need to play timer music
-                if (currentLevel == 4 && !timerMusicPlayed) {
-                    Level4* level4 = dynamic_cast<Level4*>(level);
-                    if (level4 && level4->getStormTimer() <= 660) {  
+                // React to what happened this frame
+                for (const SimEvent& e : sim->getEvents()) {
+                    if (e.type == SimEventType::EnemyHit) {
+                        if (animalCollisionSound) {
+                            Mix_PlayChannel(-1, animalCollisionSound, 0);
+                        }
+                    }
+                    else if (e.type == SimEventType::StormWarning) {
+                        // Level 4 timer music
                         if (timerSound) {
                             Mix_PlayChannel(-1, timerSound, 0);  // Play timer sound on available channel
                         }
-                        timerMusicPlayed = true;
                     }
-                }
-            }
+                    else if (e.type == SimEventType::LevelChanged) {
+                        PROFILE_ZONE("Level change");
 
-            int timeRemaining = 0;
+                        storyManager->onLevelEnd(currentLevel);
 
-            // If level 4, get the timer
-            if (currentLevel == 4)
-            {
-                Level4* lvl4 = dynamic_cast<Level4*>(level);
-                if (lvl4) {
-                    timeRemaining = lvl4->getStormTimer() / 60; // convert frames → seconds
+                        // Play level complete sound
+                        if (levelCompleteSound) {
+                            Mix_PlayChannel(-1, levelCompleteSound, 0);
+                        }
+                        currentLevel = e.value;
+
+                        storyManager->onLevelChange(currentLevel);
+                        storyManager->setLevelPointer(&sim->getLevel());
+                        // The background is swapped after the frame (texture upload)
+                    }
                 }
-            }
 
-            storyManager->update(scoreboard->getScore(), scoreboard->getLevel(), timeRemaining);
+                int timeRemaining = 0;
 
-            // FIRST ANIMAL DETECTION (Level 2) 
-            if (currentLevel == 2 && !storyManager->animalMessagePlayed)
-            {
-                // If enemies exist, an animal has spawned
-                if (!level->getEnemyItems().empty())
+                // If level 4, get the timer
+                if (currentLevel == 4 && sim->getLevel().hasStorm())
                 {
-                    storyManager->onFirstAnimal();
+                    timeRemaining = sim->getLevel().getStormTimer() / 60; // convert frames → seconds
                 }
-            }
 
-            // FIRST OIL SLICK DETECTION (Level 3) 
-            if (currentLevel == 3 && !storyManager->oilMessagePlayed)
-            {
-                 Level3* level3 = dynamic_cast<Level3*>(level);
-            if (level3)
-            {
-                // Oil slick begins the moment the warning phase activates
-                if (level3->isOilWarning())
                 {
-                    storyManager->onOilDetected();
+                    PROFILE_ZONE("StoryManager::update");
+                    storyManager->update(scoreboard->getScore(), scoreboard->getLevel(), timeRemaining);
                 }
-            }
-            }
-            
-            // Detect level changes and swap background + create new level instance
-            {
-                int newLevel = scoreboard->getLevel();
-                if (newLevel != currentLevel) {
-                   
-                    storyManager->onLevelEnd(currentLevel);
-
-                    // Play level complete sound
-                    if (levelCompleteSound) {
-                        Mix_PlayChannel(-1, levelCompleteSound, 0);
-                    }
-                    currentLevel = newLevel;
-                    
-                    // Save litter state before deleting old level
-                    std::vector<Litter> savedLitter = level->getLitterItems();
-                    std::vector<Enemies> savedEnemies = level->getEnemyItems();
-
-                    // Delete old level and create new one based on level number
-                    delete level;
-                    level = nullptr;
-
-                    storyManager->onLevelChange(currentLevel);
-                    
-                    if (currentLevel == 1) {
-                        level = new Level1(renderer,
-                                          { canTex, bottleTex, bagTex, cupTex, colaTex, smallcanTex, beerTex },
-                                          enemyTextures, enemySpeeds, enemyWidths, enemyHeights);
-                       storyManager->setLevelPointer(level);
-
-                       level->setLitterItems(savedLitter);
-                        level->setEnemyItems(savedEnemies);
-                        level->setAnimalCollisionSound(animalCollisionSound);
-                    }
-                    else if (currentLevel == 2) {                 
-                        level = new Level2(renderer,
-                                          { canTex, bottleTex, bagTex, cupTex, colaTex, smallcanTex, beerTex },
-                                          enemyTextures, enemySpeeds, enemyWidths, enemyHeights);
-                        storyManager->setLevelPointer(level);
-
-                        level->setLitterItems(savedLitter);
-                        level->setEnemyItems(savedEnemies);
-                        level->setAnimalCollisionSound(animalCollisionSound);
-                        
-                        SDL_DestroyTexture(ocean);
-                        SDL_Texture* newOcean = loadTexture(renderer, "Assets/backgrounds/Level2.png");
-                        if (newOcean) {
-                            ocean = newOcean;
-                        } else {
-                            SDL_Texture* altOcean = loadTexture(renderer, "Assets/backgrounds/Level2.png");
-                            if (altOcean) ocean = altOcean;
-                            else std::cerr << "Failed to load Level 2background: Assets/Level2.png" << std::endl;
-                        }
-                    }
-                    else if (currentLevel == 3) {
-                        level = new Level3(renderer,
-                                          { canTex, bottleTex, bagTex, cupTex, colaTex, smallcanTex, beerTex },
-                                          enemyTextures, enemySpeeds, enemyWidths, enemyHeights);
-                       storyManager->setLevelPointer(level);
-
-                        level->setLitterItems(savedLitter);
-                        level->setEnemyItems(savedEnemies);
-                        level->setOilTexture(oilTex);
-                        level->setAnimalCollisionSound(animalCollisionSound);
-                        
-                        SDL_DestroyTexture(ocean);
-                        SDL_Texture* newOcean = loadTexture(renderer, "Assets/backgrounds/Level3.png");
-                         if (newOcean) {
-                            ocean = newOcean;
-                        } else {
-                            SDL_Texture* altOcean = loadTexture(renderer, "Assets/backgrounds/Level3.png");
-                            if (altOcean) ocean = altOcean;
-                            else std::cerr << "Failed to load ocean3.png: Assets/background/Level3.png" << std::endl;
-                        }
+
+                // FIRST ANIMAL DETECTION (Level 2) 
+                if (currentLevel == 2 && !storyManager->animalMessagePlayed)
+                {
+                    // If enemies exist, an animal has spawned
+                    if (!sim->getLevel().getEnemyItems().empty())
+                    {
+                        storyManager->onFirstAnimal();
                     }
-                    else if (currentLevel >= 4) {
-                        // Load final level background FIRST
-                        SDL_DestroyTexture(ocean);
-                        SDL_Texture* trashCluster = loadTexture(renderer, "Assets/backgrounds/Level4.png");
-                        if (trashCluster) {
-                            ocean = trashCluster;
-                        } else {
-                            std::cerr << "Failed to load Level4.png" << std::endl;
-                        }
-                        
-                        // Start Level 4 intro sequence
-                        showingLevel4Intro = true;
-                        level4IntroTimer = 0;
-                        level4IntroBlinkCounter = 0;
-                        
-                        level = new Level4(renderer,
-                                          { canTex, bottleTex, bagTex, cupTex, colaTex, smallcanTex, beerTex },
-                                          enemyTextures, enemySpeeds, enemyWidths, enemyHeights);
-                        storyManager->setLevelPointer(level);
-
-                        level->setOilTexture(oilTex);
-                        level->setAnimalCollisionSound(animalCollisionSound);
+                }
+
+                // FIRST OIL SLICK DETECTION (Level 3) 
+                if (currentLevel == 3 && !storyManager->oilMessagePlayed)
+                {
+                    // Oil slick begins the moment the warning phase activates
+                    if (sim->getLevel().isOilWarning())
+                    {
+                        storyManager->onOilDetected();
                     }
                 }
             }
-        }
 
-        // Scroll background (faster in Level 4)
-        float effectiveScrollSpeed = scrollSpeed;
-        if (currentLevel == 4) {
-            Level4* level4 = dynamic_cast<Level4*>(level);
-            if (level4) {
-                effectiveScrollSpeed += level4->getScrollOffset() * 0.1f;  // Additional scroll
+            // Scroll background (faster in Level 4)
+            float effectiveScrollSpeed = scrollSpeed;
+            if (currentLevel == 4 && sim->getLevel().hasStorm()) {
+                effectiveScrollSpeed += sim->getLevel().getScrollOffset() * 0.1f;  // Additional scroll
             }
+            cameraX += effectiveScrollSpeed;
+            if (sim->isShowingLevel4Intro()) {
+                cameraX += scrollSpeed * 2.0f;  // Faster scroll during intro
+            }
+            if (cameraX >= bgWidth) cameraX -= bgWidth;
         }
-        cameraX += effectiveScrollSpeed;
-        if (cameraX >= bgWidth) cameraX -= bgWidth;
 
-        // Render
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+        simMs = msSince(simStart);
+
+        // Record the frame
+        PROFILE_ZONE("Record frame");
+        Uint64 recordStart = SDL_GetPerformanceCounter();
+        RenderStats::setDrawColor(renderer, 0, 0, 0, 255);
+        RenderStats::clear(renderer);
 
         SDL_Rect srcRect = { 0, 0, bgWidth, bgHeight };
         SDL_Rect dest1 = { static_cast<int>(-cameraX), 0, bgWidth, bgHeight };
         SDL_Rect dest2 = { static_cast<int>(-cameraX) + bgWidth, 0, bgWidth, bgHeight };
-        SDL_RenderCopy(renderer, ocean, &srcRect, &dest1);
-        SDL_RenderCopy(renderer, ocean, &srcRect, &dest2);
+        RenderStats::copy(renderer, ocean, &srcRect, &dest1);
+        RenderStats::copy(renderer, ocean, &srcRect, &dest2);
 
         // Level 4 intro overlay
-        if (showingLevel4Intro) {
-            // Render scrolling background animation
-            cameraX += scrollSpeed * 2.0f;  // Faster scroll during intro
-            
+        if (sim->isShowingLevel4Intro()) {
             // "Ready, Set, Go" 
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+            RenderStats::setBlendMode(renderer, SDL_BLENDMODE_BLEND);
             
             // Each color shows for 0.5 seconds (30 frames)
-            int phase = level4IntroBlinkCounter / 30;  // 0, 1, 2, 3, 4, 5
-            
+            int phase = sim->getLevel4IntroTimer() / 30;  // 0, 1, 2, 3, 4, 5
+
             switch (phase) {
                 case 0:
-                    SDL_SetRenderDrawColor(renderer, 255, 0, 0, 100);    // Red (Ready)
+                    RenderStats::setDrawColor(renderer, 255, 0, 0, 100);    // Red (Ready)
                     break;
                 case 1:
-                    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 100);      // Black
+                    RenderStats::setDrawColor(renderer, 0, 0, 0, 100);      // Black
                     break;
                 case 2:
-                    SDL_SetRenderDrawColor(renderer, 255, 255, 0, 100);  // Yellow (Set)
+                    RenderStats::setDrawColor(renderer, 255, 255, 0, 100);  // Yellow (Set)
                     break;
                 case 3:
-                    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 100);      // Black
+                    RenderStats::setDrawColor(renderer, 0, 0, 0, 100);      // Black
                     break;
                 case 4:
-                    SDL_SetRenderDrawColor(renderer, 0, 255, 0, 100);    // Green (Go)
+                    RenderStats::setDrawColor(renderer, 0, 255, 0, 100);    // Green (Go)
                     break;
                 default:
-                    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 100);      // Black
+                    RenderStats::setDrawColor(renderer, 0, 0, 0, 100);      // Black
                     break;
             }
             
             SDL_Rect overlayRect = {0, 0, 800, 600};
-            SDL_RenderFillRect(renderer, &overlayRect);
+            RenderStats::fillRect(renderer, &overlayRect);
             
             // Render intro text
-            TTF_Font* introFont = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 32);
-            if (introFont) {
-                SDL_Color textColor = {255, 255, 255, 255};
-                
-                // Line 1: "Final Level"
-                SDL_Surface* line1Surf = TTF_RenderText_Blended(introFont, "Final Level", textColor);
-                if (line1Surf) {
-                    SDL_Texture* line1Tex = SDL_CreateTextureFromSurface(renderer, line1Surf);
-                    if (line1Tex) {
-                        SDL_Rect line1Rect = {400 - line1Surf->w / 2, 200, line1Surf->w, line1Surf->h};
-                        SDL_RenderCopy(renderer, line1Tex, nullptr, &line1Rect);
-                        SDL_DestroyTexture(line1Tex);
-                    }
-                    SDL_FreeSurface(line1Surf);
-                }
-                
-                // Line 2: "Collect as much as you can"
-                SDL_Surface* line2Surf = TTF_RenderText_Blended(introFont, "Collect as much as you can", textColor);
-                if (line2Surf) {
-                    SDL_Texture* line2Tex = SDL_CreateTextureFromSurface(renderer, line2Surf);
-                    if (line2Tex) {
-                        SDL_Rect line2Rect = {400 - line2Surf->w / 2, 260, line2Surf->w, line2Surf->h};
-                        SDL_RenderCopy(renderer, line2Tex, nullptr, &line2Rect);
-                        SDL_DestroyTexture(line2Tex);
-                    }
-                    SDL_FreeSurface(line2Surf);
-                }
-                
-                // Line 3: "before the timer runs out!"
-                SDL_Surface* line3Surf = TTF_RenderText_Blended(introFont, "before the timer runs out!", textColor);
-                if (line3Surf) {
-                    SDL_Texture* line3Tex = SDL_CreateTextureFromSurface(renderer, line3Surf);
-                    if (line3Tex) {
-                        SDL_Rect line3Rect = {400 - line3Surf->w / 2, 320, line3Surf->w, line3Surf->h};
-                        SDL_RenderCopy(renderer, line3Tex, nullptr, &line3Rect);
-                        SDL_DestroyTexture(line3Tex);
-                    }
-                    SDL_FreeSurface(line3Surf);
-                }
-                
-                TTF_CloseFont(introFont);
+            SDL_Color textColor = {255, 255, 255, 255};
+            const char* introLines[] = {
+                "Final Level",
+                "Collect as much as you can",
+                "before the timer runs out!"
+            };
+            for (int i = 0; i < 3; i++) {
+                int w = 0;
+                introText->measure(introLines[i], &w, nullptr);
+                introText->draw(introLines[i], 400 - w / 2, 200 + i * 60, textColor);
             }
         } else {
             // Normal gameplay rendering
-            level->render();
-            submarine->render(renderer);
+            {
+                PROFILE_ZONE("LevelRenderer::render");
+                levelRenderer->render(sim->getLevel());
+                levelRenderer->renderSubmarine(sim->getSubmarine());
+            }
             
             // Level 3+: Render blackout effects (oil spots and blackout overlay)
-            level->renderBlackoutEffects(*submarine);
+            {
+                PROFILE_ZONE("LevelRenderer::renderBlackoutEffects");
+                levelRenderer->renderBlackoutEffects(sim->getLevel(), sim->getSubmarine());
+            }
             
             scoreboard->render();
 
             // Draw hearts
-            int heartSizeX = 40;
-            int heartSizeY = 35;
-            int16_t spacing = 5;
-            int startX = 5;
-            int startY = 5;
-            for (int i = 0; i < lives; ++i) {
-                SDL_Rect heartRect = { startX + i * (heartSizeX + spacing), startY, heartSizeX, heartSizeY };
-                if (heartTex) SDL_RenderCopy(renderer, heartTex, nullptr, &heartRect);
-            }
+            levelRenderer->renderHearts(sim->getLives());
+        }
+
+        storyManager->renderLevelChange(renderer);
+
+        // Render level story messages
+        {
+            PROFILE_ZONE("Messages");
+            msgManager->update();
+            msgManager->render();
         }
 
-// Check if Level 4 timer has completed (treat as game over for now)
-if (currentLevel == 4 && lives > 0) {
-    Level4* level4 = dynamic_cast<Level4*>(level);
-    if (level4 && level4->getStormTimer() <= 0) {
-        gameOver = true;  // Trigger game over when timer completes
+        perfHud->render(sim->getLevel());
+        recordMs = msSince(recordStart);
+    };
+
+    // Main loop
+    while (running) {
+        PROFILE_ZONE("Frame");
+        Uint64 frameStart = SDL_GetPerformanceCounter();
+
+        bool victoryKey = false;
+        bool pauseKey = false;
+        {
+        PROFILE_ZONE("Input");
+        while (SDL_PollEvent(&event)) {
+    if (event.type == SDL_QUIT) {
+        running = false;
     }
-}
 
-// Check for victory condition (Level 4 timer completed with lives > 0)
-bool victory = false;
-if (currentLevel == 4 && lives > 0) {
-    Level4* level4 = dynamic_cast<Level4*>(level);
-    if (level4 && level4->getStormTimer() <= 0) {
-        victory = true;
+    // F3 toggles the performance overlay
+    if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F3) {
+        perfHud->toggle();
+    }
+
+#if TS_PROFILING
+    // F9 dumps the profiler's recent history as a Chrome trace
+    if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F9) {
+        if (Profiler::writeChromeTrace(PROFILE_TRACE_PATH)) {
+            std::cout << "Wrote profiler trace to " << PROFILE_TRACE_PATH << std::endl;
+        }
+    }
+#endif
+
+    // V and ESC open menus below (during a replay the replay opens them)
+    if (!replay && event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_v) {
+        victoryKey = true;
+    }
+    if (!replay && event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE) {
+        pauseKey = true;
     }
 }
+        }
+        if (replay) {
+            victoryKey = replay->nextIsScreen(InputRecording::SCREEN_VICTORY_KEY);
+            pauseKey = replay->nextIsScreen(InputRecording::SCREEN_PAUSE);
+        }
+
+    //AUTO V ICTORY SCENE (for demo purposes)
+
+    // Press V to trigger the victory screen instantly 
+    if (victoryKey) {
+
+        // Stop all gameplay audio
+        Mix_HaltMusic();
+        if (victorySound) {
+            Mix_PlayChannel(-1, victorySound, 0);
+        }
+
+        // Show victory screen immediately with your real facts & score
+        std::string result = runScreen(InputRecording::SCREEN_VICTORY_KEY, [&] {
+            VictoryScreen vs(renderer);
+            return vs.run(scoreboard->getScore());
+        });
+        lastCounter = SDL_GetPerformanceCounter();  // Time in menus isn't game time
+
+
+        if (result == "restart") {
+            resetGame();
+            continue;
+        }
+        if (result == "menu") {
+            resetGame();
+            startGame = false;
+            return;
+        }
+        if (result == "exit") {
+            running = false;
+            break;
+        }
+    }
+
+    // PAUSE MENU (ESC)
+    if (!sim->isGameOver() && pauseKey) {
+
+        int factIndex = currentLevel - 1;
+        if (factIndex < 0) factIndex = 0;
+        if (factIndex >= facts.size()) factIndex = facts.size() - 1;
+
+        std::string action = runScreen(InputRecording::SCREEN_PAUSE, [&] {
+            GameOverScreen pause(renderer, pauseBG);
+            return pause.run("Paused", facts);
+        });
+        lastCounter = SDL_GetPerformanceCounter();  // Time in menus isn't game time
+
+        if (action == "resume") { 
+            continue;   // resume
+    }
+
+        if (action == "restart") {
+            resetGame();
+            continue;   // restart
+        }
+        if (action == "menu") {
+            resetGame();
+            startGame = false;
+            return;   // go back to main menu
+        }
+        if (action == "exit") {
+            running = false;
+            break;
+        }
+    }
+
+        // Keyboard input for this frame's ticks (events are pumped on this thread)
+        const Uint8* keys = SDL_GetKeyboardState(NULL);
+        keyboard.up = keys[SDL_SCANCODE_UP];
+        keyboard.down = keys[SDL_SCANCODE_DOWN];
+        keyboard.left = keys[SDL_SCANCODE_LEFT];
+        keyboard.right = keys[SDL_SCANCODE_RIGHT];
+        keyboard.calm = keys[SDL_SCANCODE_SPACE];  // Calm ability with SPACE
+
+        // Tick + record this frame on the worker, draw + present the last one here
+        pipeline.runFrame(renderer, buildFrame);
+
+        // The old background's last frame has been presented now
+        AssetCache::release(retiredOcean);
+        retiredOcean = nullptr;
+
+        // Getting close to the next level: decode its background now (unless
+        // an earlier game already has it cached). Done here rather than in
+        // buildFrame because AssetCache is main thread only.
+        int nextLevelScore = Simulation::scoreToLeaveLevel(currentLevel);
+        if (!sim->isGameOver() && nextLevelScore >= 0 &&
+            sim->getScore() >= nextLevelScore - PREFETCH_SCORE_MARGIN &&
+            !AssetCache::hasTexture(backgroundPath(currentLevel + 1))) {
+            assetLoader->request(backgroundPath(currentLevel + 1));
+        }
+
+        // Swap background for the new level. Cached from an earlier game, or
+        // prefetched so this is just the upload. The frame just built still
+        // uses the old one.
+        if (oceanLevel != currentLevel) {
+            SDL_Texture* newOcean = AssetCache::acquireTexture(renderer, backgroundPath(currentLevel), assetLoader);
+            if (newOcean) {
+                retiredOcean = ocean;
+                ocean = newOcean;
+            } else {
+                std::cerr << "Failed to load Level " << currentLevel << " background: " << backgroundPath(currentLevel) << std::endl;
+            }
+            oceanLevel = currentLevel;
+        }
+
+// Level 4 timer completed with lives left (the simulation flags this)
+bool victory = sim->isVictory();
 
 if (victory) {
     // Stop background music and play victory sound
@@ -736,8 +858,11 @@ if (victory) {
         Mix_PlayChannel(-1, victorySound, 0);
     }
     
-    VictoryScreen vs(renderer);
-    std::string result = vs.run(scoreboard->getScore());
+    std::string result = runScreen(InputRecording::SCREEN_VICTORY, [&] {
+        VictoryScreen vs(renderer);
+        return vs.run(scoreboard->getScore());
+    });
+    lastCounter = SDL_GetPerformanceCounter();  // Time in menus isn't game time
 
     if (result == "restart") {
         resetGame();
@@ -752,10 +877,12 @@ if (victory) {
         running = false;
         break;
     }
-} else if (gameOver) {
-    GameOverScreen go(renderer, gameOverBG);
-
-    std::string result = go.run("Game Over!", facts);
+} else if (sim->isGameOver()) {
+    std::string result = runScreen(InputRecording::SCREEN_GAME_OVER, [&] {
+        GameOverScreen go(renderer, gameOverBG);
+        return go.run("Game Over!", facts);
+    });
+    lastCounter = SDL_GetPerformanceCounter();  // Time in menus isn't game time
 
     if (result == "restart") {
         resetGame();
@@ -771,40 +898,12 @@ if (victory) {
         break;
     }
 }
-storyManager->renderLevelChange(renderer);
 
-// Render level story messages
-msgManager->update();
-msgManager->render();
+        perfHud->recordFrame(msSince(frameStart), simMs, recordMs + pipeline.getReplayMs());
 
-        SDL_RenderPresent(renderer);
-        
-        // Frame timing - maintain exactly 60 FPS
-        Uint32 frameEnd = SDL_GetTicks();
-        Uint32 frameTime = frameEnd - lastTime;
-        
-        if (frameTime < 17) {  // Target 17ms per frame for ~60 FPS
-            SDL_Delay(17 - frameTime);
+        if (autopilot && SDL_GetPerformanceCounter() >= nextSoakLog) {
+            logSoakStats();
+            nextSoakLog += perfFrequency * SOAK_LOG_SECONDS;
         }
-        
-        lastTime = SDL_GetTicks();
-    }
-
-    // Cleanup textures
-    SDL_DestroyTexture(canTex);
-    SDL_DestroyTexture(bottleTex);
-    SDL_DestroyTexture(bagTex);
-    SDL_DestroyTexture(cupTex);
-    SDL_DestroyTexture(colaTex);
-    SDL_DestroyTexture(smallcanTex);
-    SDL_DestroyTexture(beerTex);
-    SDL_DestroyTexture(swordfishTexture);
-    SDL_DestroyTexture(eelTexture);
-    SDL_DestroyTexture(octopusTexture);
-    SDL_DestroyTexture(anglerTexture);
-    SDL_DestroyTexture(sharkTexture);
-    SDL_DestroyTexture(heartTex);
-    SDL_DestroyTexture(oilTex);
-    SDL_DestroyTexture(ocean);
-    // submarine texture is owned by Submarine and will be destroyed there
-}
\ No newline at end of file
+    }
+}
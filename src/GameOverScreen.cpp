@@ -1,16 +1,15 @@
 #include "GameOverScreen.h"
+#include "FontManager.h"
+#include "RenderStats.h"
 #include <iostream>
 
 GameOverScreen::GameOverScreen(SDL_Renderer* renderer, SDL_Texture* bg)
     : renderer(renderer), background(bg), hoveredIndex(-1)
 {
-    fontLarge = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 48);
-    fontSmall = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 30);
-
-    if (!fontLarge || !fontSmall) {
-        std::cerr << "GameOverScreen Font Load Error: "
-                  << TTF_GetError() << std::endl;
-    }
+    fontLarge = FontManager::get(UI_FONT_PATH, 48);
+    fontSmall = FontManager::get(UI_FONT_PATH, 30);
+    largeText = new TextRenderer(renderer, fontLarge);
+    smallText = new TextRenderer(renderer, fontSmall);
 
     int W = 800;
     int H = 600;
@@ -25,8 +24,8 @@ GameOverScreen::GameOverScreen(SDL_Renderer* renderer, SDL_Texture* bg)
 }
 
 GameOverScreen::~GameOverScreen() {
-    if (fontLarge) TTF_CloseFont(fontLarge);
-    if (fontSmall) TTF_CloseFont(fontSmall);
+    delete largeText;
+    delete smallText;
 }
 
 bool GameOverScreen::isInside(const SDL_Rect& r, int x, int y) {
@@ -42,38 +41,32 @@ void GameOverScreen::render(const std::string& title,
     // BACKGROUND 
     if (background) {
         SDL_Rect full = {0, 0, 800, 600};
-        SDL_RenderCopy(renderer, background, NULL, &full);
+        RenderStats::copy(renderer, background, NULL, &full);
 
         // add optional dark overlay for readability
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 140);  
-        SDL_RenderFillRect(renderer, &full);
+        RenderStats::fillRect(renderer, &full);
     } 
     else {
         // fallback if no background provided
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
         SDL_Rect bg = {0, 0, 800, 600};
-        SDL_RenderFillRect(renderer, &bg);
+        RenderStats::fillRect(renderer, &bg);
     }
 
-    SDL_Color white = {255,255,255};
+    SDL_Color white = {255,255,255,255};
 
     // TITLE
-    SDL_Surface* t = TTF_RenderText_Blended(fontLarge, title.c_str(), white);
-    SDL_Texture* tt = SDL_CreateTextureFromSurface(renderer, t);
-    SDL_Rect tr = { (800 - t->w)/2, 60, t->w, t->h };
-    SDL_RenderCopy(renderer, tt, NULL, &tr);
-    SDL_FreeSurface(t);
-    SDL_DestroyTexture(tt);
+    int titleW = 0, titleH = 0;
+    largeText->measure(title, &titleW, &titleH);
+    largeText->draw(title, (800 - titleW)/2, 60, white);
 
     // FACT 
-    SDL_Surface* f = TTF_RenderText_Blended_Wrapped(fontSmall, fact.c_str(), white, 700);
-    SDL_Texture* ft = SDL_CreateTextureFromSurface(renderer, f);
-    SDL_Rect fr = { 50, 150, f->w, f->h };
-    SDL_RenderCopy(renderer, ft, NULL, &fr);
-    SDL_FreeSurface(f);
-    SDL_DestroyTexture(ft);
+    SDL_Rect fr = { 50, 150, 0, 0 };
+    smallText->measureWrapped(fact, 700, &fr.w, &fr.h);
+    smallText->drawWrapped(fact, fr.x, fr.y, white, 700);
 
     // COUNTDOWN BAR 
     int barWidth = 700;
@@ -83,11 +76,11 @@ void GameOverScreen::render(const std::string& title,
 
     SDL_Rect barBG = { barX, barY, barWidth, barHeight };
     SDL_SetRenderDrawColor(renderer, 80, 80, 80, 200);
-    SDL_RenderFillRect(renderer, &barBG);
+    RenderStats::fillRect(renderer, &barBG);
 
     SDL_Rect barFG = { barX, barY, (int)(barWidth * countdownRatio), barHeight };
     SDL_SetRenderDrawColor(renderer, 80, 180, 255, 255);
-    SDL_RenderFillRect(renderer, &barFG);
+    RenderStats::fillRect(renderer, &barFG);
 
     // Buttons
     auto drawBtn = [&](Button& b, int index) {
@@ -96,18 +89,14 @@ void GameOverScreen::render(const std::string& title,
         else
             SDL_SetRenderDrawColor(renderer, 0, 80, 160, 255);
 
-        SDL_RenderFillRect(renderer, &b.rect);
-
-        SDL_Surface* ts = TTF_RenderText_Blended(fontSmall, b.label.c_str(), white);
-        SDL_Texture* tt2 = SDL_CreateTextureFromSurface(renderer, ts);
-        SDL_Rect lr = {
-            b.rect.x + (b.rect.w - ts->w)/2,
-            b.rect.y + (b.rect.h - ts->h)/2,
-            ts->w, ts->h
-        };
-        SDL_RenderCopy(renderer, tt2, NULL, &lr);
-        SDL_FreeSurface(ts);
-        SDL_DestroyTexture(tt2);
+        RenderStats::fillRect(renderer, &b.rect);
+
+        int labelW = 0, labelH = 0;
+        smallText->measure(b.label, &labelW, &labelH);
+        smallText->draw(b.label,
+            b.rect.x + (b.rect.w - labelW)/2,
+            b.rect.y + (b.rect.h - labelH)/2,
+            white);
     };
 
     int spacing = 20;          // space between buttons
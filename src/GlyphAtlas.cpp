@@ -0,0 +1,77 @@
+#include "GlyphAtlas.h"
+#include "Profiler.h"
+#include "RenderStats.h"
+#include <iostream>
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font)
+    : texture(nullptr), height(0), fontHeight(0), lineSkip(0)
+{
+    for (Glyph& g : glyphs) {
+        g.src = { 0, 0, 0, 0 };
+        g.advance = 0;
+    }
+    if (!font) return;
+
+    PROFILE_ZONE("GlyphAtlas::build");
+    fontHeight = TTF_FontHeight(font);
+    lineSkip = TTF_FontLineSkip(font);
+
+    const int count = LAST_GLYPH - FIRST_GLYPH + 1;
+    SDL_Color white = { 255, 255, 255, 255 };
+    SDL_Surface* glyphSurfaces[count] = {};
+
+    // Rasterize each glyph and lay them out in rows
+    int penX = 0, penY = 0, rowHeight = 0;
+    for (int i = 0; i < count; i++) {
+        Uint16 ch = static_cast<Uint16>(FIRST_GLYPH + i);
+
+        int minx, maxx, miny, maxy, advance;
+        if (TTF_GlyphMetrics(font, ch, &minx, &maxx, &miny, &maxy, &advance) == 0) {
+            glyphs[i].advance = advance;
+        }
+
+        SDL_Surface* surf = TTF_RenderGlyph_Blended(font, ch, white);
+        if (!surf) continue;
+        glyphSurfaces[i] = surf;
+
+        if (penX + surf->w > WIDTH) {
+            penX = 0;
+            penY += rowHeight + 1;
+            rowHeight = 0;
+        }
+        glyphs[i].src = { penX, penY, surf->w, surf->h };
+        penX += surf->w + 1;  // 1px gap so filtering doesn't bleed
+        if (surf->h > rowHeight) rowHeight = surf->h;
+    }
+    height = penY + rowHeight;
+
+    // Copy everything into one surface and upload it once
+    SDL_Surface* sheet = nullptr;
+    if (height > 0) {
+        sheet = SDL_CreateRGBSurfaceWithFormat(0, WIDTH, height, 32, SDL_PIXELFORMAT_RGBA32);
+    }
+    if (sheet) {
+        SDL_FillRect(sheet, nullptr, 0);
+        for (int i = 0; i < count; i++) {
+            if (!glyphSurfaces[i]) continue;
+            SDL_SetSurfaceBlendMode(glyphSurfaces[i], SDL_BLENDMODE_NONE);  // Keep the glyph alpha as-is
+            SDL_BlitSurface(glyphSurfaces[i], nullptr, sheet, &glyphs[i].src);
+        }
+
+        texture = RenderStats::createTexture(renderer, sheet);
+        if (texture) {
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        } else {
+            std::cerr << "GlyphAtlas: failed to create glyph atlas: " << SDL_GetError() << std::endl;
+        }
+        SDL_FreeSurface(sheet);
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (glyphSurfaces[i]) SDL_FreeSurface(glyphSurfaces[i]);
+    }
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    if (texture) RenderStats::destroyTexture(texture);
+}
@@ -0,0 +1,172 @@
+#include "InputRecording.h"
+#include <cstdio>
+#include <iostream>
+
+// File layout:
+//   "TSRP", version byte, seed (4 bytes, little endian)
+//   then entries until EOF:
+//     0b0iiiiiii + count (LEB128)  run of `count` ticks with input bits i
+//     0b1sssdddd                  screen s, choice d
+static const char MAGIC[4] = { 'T', 'S', 'R', 'P' };
+static const uint8_t VERSION = 1;
+
+InputRecording::InputRecording(uint32_t seed)
+    : seed(seed), tickCount(0), cursor(0), usedInRun(0)
+{
+}
+
+uint8_t InputRecording::packInput(const SimInput& input) {
+    return uint8_t((input.up ? 1 : 0) |
+                   (input.down ? 2 : 0) |
+                   (input.left ? 4 : 0) |
+                   (input.right ? 8 : 0) |
+                   (input.calm ? 16 : 0));
+}
+
+SimInput InputRecording::unpackInput(uint8_t bits) {
+    SimInput input;
+    input.up = (bits & 1) != 0;
+    input.down = (bits & 2) != 0;
+    input.left = (bits & 4) != 0;
+    input.right = (bits & 8) != 0;
+    input.calm = (bits & 16) != 0;
+    return input;
+}
+
+void InputRecording::addTick(const SimInput& input) {
+    uint8_t bits = packInput(input);
+    if (!entries.empty() && entries.back().isTick && entries.back().value == bits) {
+        entries.back().count++;
+    } else {
+        entries.push_back({ true, bits, 1 });
+    }
+    tickCount++;
+}
+
+void InputRecording::addScreen(Screen screen, Choice choice) {
+    entries.push_back({ false, uint8_t((screen << 4) | choice), 1 });
+}
+
+void InputRecording::rewind() {
+    cursor = 0;
+    usedInRun = 0;
+}
+
+bool InputRecording::nextIsTick() const {
+    return !atEnd() && entries[cursor].isTick;
+}
+
+SimInput InputRecording::takeTick() {
+    if (!nextIsTick()) return SimInput();
+
+    SimInput input = unpackInput(entries[cursor].value);
+    if (++usedInRun >= entries[cursor].count) {
+        cursor++;
+        usedInRun = 0;
+    }
+    return input;
+}
+
+bool InputRecording::nextIsScreen(Screen screen) const {
+    return !atEnd() && !entries[cursor].isTick && (entries[cursor].value >> 4) == screen;
+}
+
+bool InputRecording::takeScreen(Screen screen, Choice& choice) {
+    if (!nextIsScreen(screen)) return false;
+    choice = Choice(entries[cursor].value & 0x0F);
+    cursor++;
+    usedInRun = 0;
+    return true;
+}
+
+std::string InputRecording::pathForGame(const std::string& path, int game) {
+    if (game <= 1) return path;
+
+    // Only a dot inside the file name (not leading it) starts an extension
+    size_t slash = path.find_last_of("/\\");
+    size_t nameStart = (slash == std::string::npos) ? 0 : slash + 1;
+    size_t dot = path.rfind('.');
+    if (dot == std::string::npos || dot <= nameStart) dot = path.size();
+    return path.substr(0, dot) + "-" + std::to_string(game) + path.substr(dot);
+}
+
+bool InputRecording::save(const std::string& path) const {
+    FILE* out = fopen(path.c_str(), "wb");
+    if (!out) return false;
+
+    fwrite(MAGIC, 1, 4, out);
+    fputc(VERSION, out);
+    for (int i = 0; i < 4; i++) fputc((seed >> (8 * i)) & 0xFF, out);
+
+    for (const Entry& e : entries) {
+        if (e.isTick) {
+            fputc(e.value & 0x7F, out);
+            unsigned count = unsigned(e.count);
+            do {
+                uint8_t byte = count & 0x7F;
+                count >>= 7;
+                fputc(count ? (byte | 0x80) : byte, out);
+            } while (count);
+        } else {
+            fputc(0x80 | e.value, out);
+        }
+    }
+
+    bool ok = !ferror(out);
+    fclose(out);
+    return ok;
+}
+
+bool InputRecording::load(const std::string& path) {
+    FILE* in = fopen(path.c_str(), "rb");
+    if (!in) return false;
+
+    char magic[4];
+    bool ok = fread(magic, 1, 4, in) == 4 &&
+              magic[0] == MAGIC[0] && magic[1] == MAGIC[1] && magic[2] == MAGIC[2] && magic[3] == MAGIC[3] &&
+              fgetc(in) == VERSION;
+
+    uint32_t fileSeed = 0;
+    for (int i = 0; ok && i < 4; i++) {
+        int c = fgetc(in);
+        if (c == EOF) ok = false;
+        fileSeed |= uint32_t(c & 0xFF) << (8 * i);
+    }
+
+    std::vector<Entry> fileEntries;
+    int fileTicks = 0;
+    int c;
+    while (ok && (c = fgetc(in)) != EOF) {
+        if (c & 0x80) {
+            fileEntries.push_back({ false, uint8_t(c & 0x7F), 1 });
+            continue;
+        }
+
+        unsigned count = 0;
+        int shift = 0;
+        int byte;
+        do {
+            byte = fgetc(in);
+            if (byte == EOF || shift > 28) { ok = false; break; }
+            count |= unsigned(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+
+        if (ok && count > 0) {
+            fileEntries.push_back({ true, uint8_t(c), int(count) });
+            fileTicks += int(count);
+        }
+    }
+    fclose(in);
+
+    if (!ok) {
+        std::cerr << "Not a valid replay file: " << path << std::endl;
+        return false;
+    }
+
+    seed = fileSeed;
+    entries = fileEntries;
+    tickCount = fileTicks;
+    rewind();
+    return true;
+}
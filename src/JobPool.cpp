@@ -0,0 +1,118 @@
+#include "JobPool.h"
+#include <algorithm>
+#include "Profiler.h"
+
+JobPool::JobPool(int threadCount)
+    : body(nullptr),
+      count(0),
+      grain(1),
+      remaining(0),
+      steals(0),
+      generation(0),
+      stopping(false)
+{
+    if (threadCount <= 0) threadCount = (int)std::thread::hardware_concurrency();
+    if (threadCount < 1) threadCount = 1;
+
+    queueCount = threadCount;
+    queues = new Queue[queueCount];
+    for (int i = 1; i < queueCount; i++) {
+        workers.emplace_back(&JobPool::workerLoop, this, i);
+    }
+}
+
+JobPool::~JobPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workReady.notify_all();
+    for (std::thread& t : workers) t.join();
+    delete[] queues;
+}
+
+void JobPool::parallelFor(int count_, int grain_, const RangeFn& body_) {
+    if (grain_ < 1) grain_ = 1;
+    int chunks = chunkCount(count_, grain_);
+    if (chunks == 0) return;
+
+    // Nothing to share: skip the hand-off
+    if (chunks == 1 || workers.empty()) {
+        for (int c = 0; c < chunks; c++) {
+            body_(c, c * grain_, std::min(count_, (c + 1) * grain_));
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        body = &body_;
+        count = count_;
+        grain = grain_;
+        remaining.store(chunks);
+
+        // Contiguous runs per thread, so neighbouring chunks share a thread
+        // unless someone has to steal
+        for (int q = 0; q < queueCount; q++) {
+            std::lock_guard<std::mutex> queueLock(queues[q].mutex);
+            int first = int((long long)chunks * q / queueCount);
+            int last = int((long long)chunks * (q + 1) / queueCount);
+            for (int c = first; c < last; c++) queues[q].chunks.push_back(c);
+        }
+        generation++;
+    }
+    workReady.notify_all();
+
+    while (runOne(0)) {}
+
+    // Wait for the chunks other threads are still on
+    std::unique_lock<std::mutex> lock(mutex);
+    allDone.wait(lock, [this] { return remaining.load() == 0; });
+    body = nullptr;
+}
+
+bool JobPool::runOne(int self) {
+    int chunk = -1;
+    {
+        Queue& own = queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.chunks.empty()) {
+            chunk = own.chunks.front();
+            own.chunks.pop_front();
+        }
+    }
+    for (int i = 1; chunk < 0 && i < queueCount; i++) {
+        Queue& victim = queues[(self + i) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.chunks.empty()) {
+            chunk = victim.chunks.back();
+            victim.chunks.pop_back();
+            steals.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (chunk < 0) return false;
+
+    {
+        PROFILE_ZONE("JobPool chunk");
+        (*body)(chunk, chunk * grain, std::min(count, (chunk + 1) * grain));
+    }
+    if (remaining.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        allDone.notify_all();
+    }
+    return true;
+}
+
+void JobPool::workerLoop(int self) {
+    PROFILE_THREAD_NAME("Job worker");
+    unsigned seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workReady.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+        while (runOne(self)) {}
+    }
+}
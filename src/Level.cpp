@@ -1,56 +1,101 @@
 #include "Level.h"
-#include <SDL.h>
 #include <cstdlib>
-#include <ctime>
 #include <iostream>
 #include <cmath>
 #include <algorithm>
-#include <SDL_ttf.h>
+
+namespace {
+
+// Erase the items whose flag is set, keeping the rest in order (same as
+// erasing them one by one while walking the vector)
+template <typename T>
+void eraseFlagged(std::vector<T>& items, const std::vector<uint8_t>& flags) {
+    size_t kept = 0;
+    for (size_t i = 0; i < items.size(); i++) {
+        if (flags[i]) continue;
+        if (kept != i) items[kept] = std::move(items[i]);
+        kept++;
+    }
+    items.erase(items.begin() + kept, items.end());
+}
+
+}  // namespace
 
 // Base Level Class Implementation
-Level::Level(SDL_Renderer* renderer_, const std::vector<SDL_Texture*>& litterTextures,
-             const std::vector<SDL_Texture*>& enemyTextures_, const std::vector<float>& enemySpeeds_,
-             const std::vector<int>& enemyWidths_, const std::vector<int>& enemyHeights_)
-    : renderer(renderer_), enemyTextures(enemyTextures_), enemySpeeds(enemySpeeds_), 
-      enemyWidths(enemyWidths_), enemyHeights(enemyHeights_), spawnTimer(0),
-      spawnInterval(120), maxActiveEnemies(2), animalCollisionSound(nullptr),
-      oilTexture(nullptr), blackoutNext(0), warningFrameCounter(0), 
-      isBlackout(false), isWarning(false), blackoutCounter(0),
-      blackoutInterval(600), blackoutWarning(120), blackoutDuration(300), blackoutWidth(0),
-      isBlackoutFading(false), isBlackoutFullyCovered(false), fullCoverCounter(0)
+Level::Level(const SimConfig& config, const Features& features_)
+    : features(features_), world(&ownWorld),
+      litterWidths(config.litterWidths), litterHeights(config.litterHeights),
+      enemySpeeds(config.enemySpeeds), 
+      enemyWidths(config.enemyWidths), enemyHeights(config.enemyHeights), spawnTimer(0),
+      spawnInterval(config.spawnInterval), maxActiveEnemies(config.maxActiveEnemies),
+      blackoutInterval(600), blackoutWarning(120), blackoutDuration(300),
+      scaledWidths(config.litterWidths), scaledHeights(config.litterHeights),
+      stormFrames(config.stormFrames),  // 60 seconds at 60 FPS by default
+      litterGridCount(0), enemyGridCount(0), enemyGridValid(false),
+      jobPool(nullptr), jobGrain(DEFAULT_JOB_GRAIN)
 {
-    std::vector<int> litterWidths;
-    std::vector<int> litterHeights;
+}
 
-    for (auto tex : litterTextures) {
-        int w = 0, h = 0;
-        SDL_QueryTexture(tex, NULL, NULL, &w, &h);
+void Level::setWorld(World* world_) {
+    world = world_ ? world_ : &ownWorld;
+    enemyGridValid = false;
+}
 
-        // Scale down here if you want universal smaller sizes
-        float scale = 0.15f;  
-        w = int(w * scale);
-        h = int(h * scale);
+void Level::reset(uint64_t seed) {
+    enter(seed);
+    world->clear();
+    placeStartingLitter();
+}
 
-        litterWidths.push_back(w);
-        litterHeights.push_back(h);
+void Level::enter(uint64_t seed) {
+    enemyRng.reseed(seed, STREAM_ENEMY_SPAWN);
+    litterRng.reseed(seed, STREAM_LITTER_SPAWN);
+    respawnRng.reseed(seed, STREAM_LITTER_RESPAWN);
+    inkRng.reseed(seed, STREAM_INK);
 
-    }
+    // clear() keeps the capacity, so a reused level doesn't allocate
+    litterFlow.clear();
+    oilSpots.clear();
+    spawnTimer = 0;
+
+    // Blackout state
+    blackoutNext = 0;
+    warningFrameCounter = 0;
+    isBlackout = false;
+    isWarning = false;
+    blackoutCounter = 0;
+    blackoutWidth = 0;
+    isBlackoutFading = false;
+    isBlackoutFullyCovered = false;
+    fullCoverCounter = 0;
+    enemyGridValid = false;
+    std::fill(blackoutWaves.begin(), blackoutWaves.end(), 0);
+
+    // Storm state
+    stormTimer = features.storm ? stormFrames : 0;
+    scrollOffset = 0;
+    cameraShakeFrames = 0;
+    litterSpawnTimer = 0;
+}
 
-    // Create litter from provided textures using the original initial positions/speeds
-    if (litterTextures.size() >= 7) {
-        litterItems.emplace_back(Litter(litterTextures[0], 200, 300, 1.5f, litterWidths[0], litterHeights[0]));
-        litterItems.emplace_back(Litter(litterTextures[1], 500, 400, 2.0f, litterWidths[1], litterHeights[1]));
-        litterItems.emplace_back(Litter(litterTextures[2], 650, 250, 1.8f, litterWidths[2], litterHeights[2]));
-        litterItems.emplace_back(Litter(litterTextures[3], 350, 200, 1.3f, litterWidths[3], litterHeights[3]));
-        litterItems.emplace_back(Litter(litterTextures[4], 700, 500, 2.2f, litterWidths[4], litterHeights[4]));
-        litterItems.emplace_back(Litter(litterTextures[5], 100, 450, 1.6f, litterWidths[5], litterHeights[5]));
-        litterItems.emplace_back(Litter(litterTextures[6], 400, 350, 1.9f, litterWidths[6], litterHeights[6]));
+void Level::placeStartingLitter() {
+    if (!features.startingLitter) return;   // The storm starts in open water
+
+    // Create litter using the original initial positions/speeds
+    if (litterWidths.size() >= 7) {
+        world->litter.emplace_back(Litter(SPRITE_CAN, 200, 300, 1.5f, litterWidths[0], litterHeights[0]));
+        world->litter.emplace_back(Litter(SPRITE_BOTTLE, 500, 400, 2.0f, litterWidths[1], litterHeights[1]));
+        world->litter.emplace_back(Litter(SPRITE_BAG, 650, 250, 1.8f, litterWidths[2], litterHeights[2]));
+        world->litter.emplace_back(Litter(SPRITE_CUP, 350, 200, 1.3f, litterWidths[3], litterHeights[3]));
+        world->litter.emplace_back(Litter(SPRITE_COLA, 700, 500, 2.2f, litterWidths[4], litterHeights[4]));
+        world->litter.emplace_back(Litter(SPRITE_SMALLCAN, 100, 450, 1.6f, litterWidths[5], litterHeights[5]));
+        world->litter.emplace_back(Litter(SPRITE_BEER, 400, 350, 1.9f, litterWidths[6], litterHeights[6]));
     } else {
-        for (int i = 0; i < litterTextures.size(); i++) {
-            litterItems.emplace_back(
-                Litter(litterTextures[i],
+        for (int i = 0; i < litterWidths.size(); i++) {
+            world->litter.emplace_back(
+                Litter(SPRITE_CAN + i,
                     850,
-                    rand() % 500 + 50,
+                    litterRng.range(50, 550),
                     1.5f,
                     litterWidths[i],
                     litterHeights[i])
@@ -59,118 +104,181 @@ Level::Level(SDL_Renderer* renderer_, const std::vector<SDL_Texture*>& litterTex
     }
 }
 
-Level::~Level() {}
+void Level::setJobPool(JobPool* pool, int grain) {
+    jobPool = pool;
+    jobGrain = grain < 1 ? 1 : grain;
+}
+
+int Level::forEachChunk(int count, const JobPool::RangeFn& body) {
+    int grain = jobPool ? jobGrain : std::max(count, 1);
+    int chunks = JobPool::chunkCount(count, grain);
+    if ((int)chunkResults.size() < chunks) chunkResults.resize(chunks);
+    for (int c = 0; c < chunks; c++) chunkResults[c].clear();
 
-void Level::reset() {
-    // Reset litter positions and make them active
-    for (auto& l : litterItems) {
-        l.active = true;
-        l.x = 850; l.y = rand() % 500 + 50;
+    if (jobPool) {
+        jobPool->parallelFor(count, grain, body);
+    } else if (count > 0) {
+        body(0, 0, count);
     }
-    enemyItems.clear();
-    spawnTimer = 0;
-    
-    // Reset blackout variables
-    blackoutNext = 0;
-    isBlackout = false;
-    isWarning = false;
-    blackoutCounter = 0;
-    warningFrameCounter = 0;
-    blackoutWidth = 0;
-    isBlackoutFading = false;
-    isBlackoutFullyCovered = false;
-    fullCoverCounter = 0;
+    return chunks;
 }
 
-void Level::update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bool& gameOver) {
-    // Update litter
-    for (auto& litter : litterItems) {
-        bool missed = litter.update();
-        if (missed) {
-            scoreboard.setScore(scoreboard.getScore() - 10);
-        }
-        if (litter.active && litter.checkCollision(submarine.getRect())) {
-            litter.collect();
-            scoreboard.setScore(scoreboard.getScore() + 10);
+void Level::setSpawnableEnemies(const std::vector<int>& types) {
+    spawnableEnemies.clear();
+    for (int type : types) {
+        if (type >= 0 && type < (int)enemySpeeds.size() &&
+            type < (int)enemyWidths.size() && type < (int)enemyHeights.size()) {
+            spawnableEnemies.push_back(type);
         }
     }
-
-    // Update enemies (can be overridden in derived classes)
-    updateEnemies(submarine, lives, gameOver);
-    
-    // Update blackout mechanic (only active in Level 3)
-    updateBlackoutMechanic();
 }
 
-void Level::updateEnemies(Submarine& submarine, int& lives, bool& gameOver) {
+bool Level::enemySpawnDue() {
     // Spawn enemies periodically
     spawnTimer++;
-    if (spawnTimer >= spawnInterval) {
-        spawnTimer = 0;
-        int activeCount = 0;
-        for (const auto& enemy : enemyItems) if (enemy.active) activeCount++;
-        if (activeCount < maxActiveEnemies && !enemyTextures.empty()) {
-            int randomIndex = rand() % enemyTextures.size();
-            float startX, startY;
-            
-            // Octopus spawns from bottom, others from right
-            if (randomIndex == 2) {
-                startX = rand() % 700 + 50;  // Random X position across screen
-                startY = 600;  // Start from bottom
-            } else {
-                startX = 850;  // Start from right
-                startY = rand() % 500 + 50;  // Random Y position
+    if (spawnTimer < spawnInterval) return false;
+    spawnTimer = 0;
+
+    int activeCount = 0;
+    for (const auto& enemy : world->enemies) if (enemy.active) activeCount++;
+    return activeCount < maxActiveEnemies && !spawnableEnemies.empty();
+}
+
+void Level::updateLitter(std::vector<SimEvent>& events) {
+    std::vector<Litter>& litter = world->litter;
+
+    // Move in parallel; litter that needs a new height is noted per chunk
+    forEachChunk((int)litter.size(), [this, &litter](int chunk, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            Litter::Step step = litter[i].advance();
+            if (step != Litter::STEP_NONE) chunkResults[chunk].push_back({ i, step });
+        }
+    });
+
+    // Chunks in order are litter order, so respawnRng draws what a plain loop would
+    for (const auto& results : chunkResults) {
+        for (const auto& result : results) {
+            litter[result.first].respawn(respawnRng);
+            if (result.second == Litter::STEP_WRAPPED) {
+                events.push_back({ SimEventType::LitterMissed, 10 });
             }
-            
-            enemyItems.emplace_back(enemyTextures[randomIndex], startX, startY, enemySpeeds[randomIndex],
-                                   enemyWidths[randomIndex], enemyHeights[randomIndex], randomIndex);
         }
     }
+}
 
-    // Update enemies
-    SDL_Rect subRect = submarine.getRect();
+void Level::moveEnemies(const Submarine& submarine, bool octopusExitsTop) {
+    SimRect subRect = submarine.getRect();
     float subX = subRect.x + subRect.w / 2.0f;
     float subY = subRect.y + subRect.h / 2.0f;
-    
-    for (auto it = enemyItems.begin(); it != enemyItems.end();) {
-        // Remove enemies that go off screen
-        // Octopus removed when going off top, others when going off left
-        bool offScreen = (it->enemyType == 2 && it->y < -100) || 
-                        (it->enemyType != 2 && it->x < -100) || 
-                        (it->y > 600 && it->falling);
-        
-        if (offScreen) {
-            it = enemyItems.erase(it);
+
+    // Enemies already off screen are dropped instead of updated
+    std::vector<Enemies>& enemies = world->enemies;
+    size_t countBefore = enemies.size();
+    removeFlags.assign(enemies.size(), 0);
+    forEachChunk((int)enemies.size(), [&](int, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            Enemies& e = enemies[i];
+            bool leftTop = octopusExitsTop && e.enemyType == 2;
+            bool offScreen = (leftTop ? e.y < -100 : e.x < -100) || (e.y > 600 && e.falling);
+            if (offScreen) {
+                removeFlags[i] = 1;
+            } else {
+                e.update(subX, subY);
+            }
+        }
+    });
+    eraseFlagged(enemies, removeFlags);
+
+    // The one grid update this tick; hitEnemies and the next calm use it.
+    // An erase shifts every id after it, which is cheaper to rebuild.
+    if (enemies.size() != countBefore) enemyGridValid = false;
+    syncEnemyGrid();
+}
+
+// The grids are updated in place: every id still in use is re-inserted
+// (a move, usually within the same cells) and ids past the end are taken
+// out. Ids that swapped entities are just moves too.
+
+void Level::syncLitterGrid() {
+    const std::vector<Litter>& litter = world->litter;
+    int count = (int)litter.size();
+    for (int i = 0; i < count; i++) {
+        const Litter& l = litter[i];
+        if (l.active) litterGrid.insert(i, { (int)l.x, (int)l.y, l.getWidth(), l.getHeight() });
+        else litterGrid.remove(i);
+    }
+    for (int i = count; i < litterGridCount; i++) litterGrid.remove(i);
+    litterGridCount = count;
+}
+
+void Level::syncFlowGrid() {
+    int count = litterFlow.size();
+    for (int i = 0; i < count; i++) {
+        // Same truncation as Litter::checkCollision
+        if (litterFlow.flags[i] & EntityStore::FLAG_ACTIVE) {
+            litterGrid.insert(i, { (int)litterFlow.x[i], (int)litterFlow.y[i], litterFlow.width[i], litterFlow.height[i] });
         } else {
-            it->update(subX, subY);
-            if (it->checkCollision(submarine.getRect()) && !it->falling) {
-                lives--;
-                submarine.startHitBlink();
-                it->startHitBlink();
-                it->startFalling();
-                if (animalCollisionSound) {
-                    Mix_PlayChannel(-1, animalCollisionSound, 0);
-                }
-                if (lives <= 0) gameOver = true;
-                ++it;
-            } else ++it;
+            litterGrid.remove(i);
         }
     }
+    for (int i = count; i < litterGridCount; i++) litterGrid.remove(i);
+    litterGridCount = count;
 }
 
-// Default: no blackout mechanic (only in Level 3)
-void Level::updateBlackoutMechanic() {}
+void Level::syncEnemyGrid() {
+    // Not kept in step (renumbered or handed out): start from empty
+    if (!enemyGridValid) {
+        enemyGrid.clear();
+        enemyGridCount = 0;
+    }
 
-void Level::render() {
-    for (auto& litter : litterItems) litter.render(renderer);
-    for (auto& e : enemyItems) e.render(renderer);
+    const std::vector<Enemies>& enemies = world->enemies;
+    int count = (int)enemies.size();
+    for (int i = 0; i < count; i++) {
+        const Enemies& e = enemies[i];
+        if (e.active) {
+            enemyGrid.insert(i, { (int)e.x, (int)e.y, e.width, e.height },
+                             e.x + e.width / 2.0f, e.y + e.height / 2.0f);
+        } else {
+            enemyGrid.remove(i);
+        }
+    }
+    for (int i = count; i < enemyGridCount; i++) enemyGrid.remove(i);
+    enemyGridCount = count;
+    enemyGridValid = true;
+}
+
+void Level::collectLitter(Submarine& submarine, std::vector<SimEvent>& events) {
+    syncLitterGrid();
+    litterGrid.queryRect(submarine.getRect(), gridHits);
+    std::sort(gridHits.begin(), gridHits.end());  // Same order as walking the vector
+    for (int i : gridHits) {
+        world->litter[i].collect();
+        events.push_back({ SimEventType::LitterCollected, 10 });
+    }
 }
 
-// Default: no blackout effects (only in Level 3)
-void Level::renderBlackoutEffects(Submarine& submarine) {}
+void Level::hitEnemies(Submarine& submarine, std::vector<SimEvent>& events) {
+    enemyGrid.queryRect(submarine.getRect(), gridHits);
+    std::sort(gridHits.begin(), gridHits.end());
+    for (int i : gridHits) {
+        Enemies& enemy = world->enemies[i];
+        if (enemy.falling) continue;
+        submarine.startHitBlink();
+        enemy.startHitBlink();
+        enemy.startFalling();
+        events.push_back({ SimEventType::EnemyHit, 1, enemy.enemyType });
+    }
+}
 
 void Level::calmEnemies(float subX, float subY, float radius) {
-    for (auto& enemy : enemyItems) {
+    // Only the enemies near the submarine need the exact check below.
+    // Nothing has moved since moveEnemies updated the grid, unless the
+    // enemies were handed out for changing.
+    if (!enemyGridValid) syncEnemyGrid();
+    enemyGrid.queryRadius(subX, subY, radius + 1.0f, gridHits);  // A little slack, the float check decides
+    for (int i : gridHits) {
+        Enemies& enemy = world->enemies[i];
         if (!enemy.active || enemy.calmed) continue;
         
         // Calculate distance from submarine to enemy center
@@ -198,112 +306,54 @@ void Level::calmEnemies(float subX, float subY, float radius) {
     }
 }
 
-void Level::setOilTexture(SDL_Texture* oilTex) {
-    oilTexture = oilTex;
-}
+// Oil blackout (Level 3)
 
-// Level 1: Only Litter, no animals 
+namespace {
 
-Level1::Level1(SDL_Renderer* renderer,
-               const std::vector<SDL_Texture*>& litterTextures,
-               const std::vector<SDL_Texture*>& enemyTextures,
-               const std::vector<float>& enemySpeeds,
-               const std::vector<int>& enemyWidths,
-               const std::vector<int>& enemyHeights)
-    : Level(renderer, litterTextures, enemyTextures, enemySpeeds, enemyWidths, enemyHeights)
-{
-}
+// sin() from a lookup table, linearly interpolated. Far more precise than
+// the whole pixels the blackout edge is measured in.
+struct SineTable {
+    static const int SIZE = 1024;   // Steps per full turn (power of two)
+    float values[SIZE + 1];
 
-void Level1::update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bool& gameOver) {
-    for (auto& litter : litterItems) {
-        bool missed = litter.update();
-        if (missed) {
-            scoreboard.setScore(scoreboard.getScore() - 10);
-        }
-        if (litter.active && litter.checkCollision(submarine.getRect())) {
-            litter.collect();
-            scoreboard.setScore(scoreboard.getScore() + 10);
+    SineTable() {
+        for (int i = 0; i <= SIZE; i++) {
+            values[i] = std::sin(i * 6.28318530718f / SIZE);
         }
     }
-}
-
-// Level 2: Litter + Animals (uses base class implementation)
-Level2::Level2(SDL_Renderer* renderer,
-               const std::vector<SDL_Texture*>& litterTextures,
-               const std::vector<SDL_Texture*>& enemyTextures,
-               const std::vector<float>& enemySpeeds,
-               const std::vector<int>& enemyWidths,
-               const std::vector<int>& enemyHeights)
-    : Level(renderer, litterTextures, enemyTextures, enemySpeeds, enemyWidths, enemyHeights)
-{
-}
 
-void Level2::updateEnemies(Submarine& submarine, int& lives, bool& gameOver) {
-    // Spawn enemies periodically
-    spawnTimer++;
-    if (spawnTimer >= spawnInterval) {
-        spawnTimer = 0;
-        int activeCount = 0;
-        for (const auto& enemy : enemyItems) if (enemy.active) activeCount++;
-        if (activeCount < maxActiveEnemies && !enemyTextures.empty()) {
-            // Exclude octopus
-            int randomIndex;
-            do {
-                randomIndex = rand() % enemyTextures.size();
-            } while (randomIndex == 2);  // Skip octopus
-            
-            float startX = 850;  // Start from right
-            float startY = rand() % 500 + 50;  // Random Y position
-            
-            enemyItems.emplace_back(enemyTextures[randomIndex], startX, startY, enemySpeeds[randomIndex],
-                                   enemyWidths[randomIndex], enemyHeights[randomIndex], randomIndex);
-        }
+    float operator()(float radians) const {
+        float t = radians * (SIZE / 6.28318530718f);
+        float whole = std::floor(t);
+        int i = int(whole) & (SIZE - 1);  // Wraps negative angles too
+        float frac = t - whole;
+        return values[i] + (values[i + 1] - values[i]) * frac;
     }
+};
 
-    // Update enemies (same as base class)
-    SDL_Rect subRect = submarine.getRect();
-    float subX = subRect.x + subRect.w / 2.0f;
-    float subY = subRect.y + subRect.h / 2.0f;
-    
-    for (auto it = enemyItems.begin(); it != enemyItems.end();) {
-        bool offScreen = it->x < -100 || (it->y > 600 && it->falling);
-        
-        if (offScreen) {
-            it = enemyItems.erase(it);
-        } else {
-            it->update(subX, subY);
-            if (it->checkCollision(submarine.getRect()) && !it->falling) {
-                lives--;
-                submarine.startHitBlink();
-                it->startHitBlink();
-                it->startFalling();
-                if (animalCollisionSound) {
-                    Mix_PlayChannel(-1, animalCollisionSound, 0);
-                }
-                if (lives <= 0) gameOver = true;
-                ++it;
-            } else ++it;
-        }
-    }
+const SineTable& sineTable() {
+    static const SineTable table;
+    return table;
 }
 
-// Level 3: Litter + Animals + Oil blackout mechanics
+}  // namespace
 
-Level3::Level3(SDL_Renderer* renderer,
-               const std::vector<SDL_Texture*>& litterTextures,
-               const std::vector<SDL_Texture*>& enemyTextures,
-               const std::vector<float>& enemySpeeds,
-               const std::vector<int>& enemyWidths,
-               const std::vector<int>& enemyHeights)
-    : Level(renderer, litterTextures, enemyTextures, enemySpeeds, enemyWidths, enemyHeights)
-{
+int Level::waveOffsetAt(int y) const {
+    // Irregular wave pattern from three sine waves at different frequencies
+    const SineTable& fastSin = sineTable();
+    float wave1 = fastSin((y * 0.05f) + (blackoutCounter * 0.03f)) * 25.0f;   // Primary wave
+    float wave2 = fastSin((y * 0.15f) + (blackoutCounter * 0.05f)) * 15.0f;   // Secondary faster wave
+    float wave3 = fastSin((y * 0.08f) - (blackoutCounter * 0.02f)) * 10.0f;   // Tertiary wave moving opposite
+    return static_cast<int>(wave1 + wave2 + wave3);
 }
 
-void Level3::update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bool& gameOver) {
-    // Call base class update
-    Level::update(submarine, scoreboard, lives, gameOver);
-    
-    // Level 3 specific: Update blackout mechanic
+void Level::updateBlackoutWaves() {
+    for (int y = 0; y < (int)blackoutWaves.size(); y++) {
+        blackoutWaves[y] = waveOffsetAt(y);
+    }
+}
+
+void Level::updateBlackout() {
     blackoutNext++;
     if (isBlackoutFading) {
         blackoutCounter++; 
@@ -354,118 +404,54 @@ void Level3::update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bo
         }
     }
     
+    // Wave edge for this tick (used by isPositionInBlackout and the renderer)
+    if (isBlackout || isBlackoutFading) {
+        updateBlackoutWaves();
+    }
+}
+
+void Level::updateInk() {
     // Create ink splotches near octopuses
-    for (auto& enemy : enemyItems) {
+    for (auto& enemy : world->enemies) {
         if (enemy.enemyType == 2 && enemy.active) {
             // Random chance to spawn ink
-            if (rand() % 100 < 5) {
+            if (inkRng.chance(5)) {
                 OilSpot inkSpot;
                 // Spawn ink near the octopus position
-                inkSpot.x = static_cast<int>(enemy.x) - 50 + (rand() % 100);
-                inkSpot.y = static_cast<int>(enemy.y) - 50 + (rand() % 100);
-                inkSpot.size = 250 + (rand() % 150);  // Random size 250-400
+                inkSpot.x = static_cast<int>(enemy.x) - 50 + inkRng.below(100);
+                inkSpot.y = static_cast<int>(enemy.y) - 50 + inkRng.below(100);
+                inkSpot.size = inkRng.range(250, 400);  // Random size 250-400
                 inkSpot.spawnFrame = 0;
                 inkSpot.alpha = 0.0f;
                 oilSpots.push_back(inkSpot);
             }
         }
     }
-    
-    // Fade in and fade out ink spots
-    for (auto it = oilSpots.begin(); it != oilSpots.end();) {
-        it->spawnFrame++;
-        
-        // Fade in for first 20 frames
-        if (it->spawnFrame < 20) {
-            it->alpha += 0.05f;
-            if (it->alpha > 1.0f) it->alpha = 1.0f;
-            ++it;
-        }
-        // Stay visible for 60 frames
-        else if (it->spawnFrame < 80) {
-            ++it;
-        }
-        // Fade out for next 20 frames
-        else if (it->spawnFrame < 100) {
-            it->alpha -= 0.05f;
-            if (it->alpha < 0.0f) it->alpha = 0.0f;
-            ++it;
-        }
-        // Remove after fully faded
-        else {
-            it = oilSpots.erase(it);
-        }
-    }
-}
 
-void Level3::renderBlackoutEffects(Submarine& submarine) {
-    // Show ink spots with fade-in effect
-    if (oilTexture) {
-        for (const auto& spot : oilSpots) {
-            if (spot.alpha > 0.0f) {
-                SDL_SetTextureAlphaMod(oilTexture, static_cast<Uint8>(spot.alpha * 240));  // Max 240 for darker ink
-                SDL_Rect inkRect = { spot.x, spot.y, spot.size, spot.size };
-                SDL_RenderCopy(renderer, oilTexture, nullptr, &inkRect);
-            }
-        }
-        // Reset alpha mod
-        SDL_SetTextureAlphaMod(oilTexture, 240);
-    }
-    
-    // Full blackout overlay - expands from right edge with wavy border
-    if (isBlackout || isBlackoutFading) {
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
-        
-        // If blackout has fully expanded and not fading, just fill the entire screen
-        if (blackoutWidth >= 800 && !isBlackoutFading) {
-            SDL_Rect fullScreen = {0, 0, 800, 600};
-            SDL_RenderFillRect(renderer, &fullScreen);
-        } else {
-            // Draw blackout with wavy, irregular edge using vertical strips
-            // Loop through each horizontal line of the screen
-            for (int y = 0; y < 600; y++) {
-                // Create irregular wave pattern using multiple sine waves at different frequencies
-                // Combining multiple sine waves creates a more organic, irregular pattern
-                float wave1 = sin((y * 0.05f) + (blackoutCounter * 0.03f)) * 25.0f;        // Primary wave
-                float wave2 = sin((y * 0.15f) + (blackoutCounter * 0.05f)) * 15.0f;       // Secondary faster wave
-                float wave3 = sin((y * 0.08f) - (blackoutCounter * 0.02f)) * 10.0f;       // Tertiary wave moving opposite
-                float wave = wave1 + wave2 + wave3;  // Combine all waves for irregular pattern
-                
-                int xStart, width;
-                
-                if (isBlackoutFading) {
-                    xStart = 0;
-                    int xEnd = blackoutWidth + static_cast<int>(wave);
-                    // Clamp to screen bounds
-                    if (xEnd < 0) xEnd = 0;
-                    if (xEnd > 800) xEnd = 800;
-                    
-                    width = xEnd;
-                } else {
-                    xStart = 800 - blackoutWidth + static_cast<int>(wave);
-                    // Clamp to screen bounds to prevent drawing outside the window
-                    if (xStart < 0) xStart = 0;
-                    if (xStart > 800) xStart = 800;
-                    
-                    // Calculate the width of the blackout strip for this row
-                    width = 800 - xStart;
-                }
-                
-                if (width > 0) {
-                    // Draw a 1-pixel tall horizontal strip for this row
-                    SDL_Rect stripRect = {xStart, y, width, 1};
-                    SDL_RenderFillRect(renderer, &stripRect);
-                }
+    // Fade in and fade out ink spots
+    removeFlags.assign(oilSpots.size(), 0);
+    forEachChunk((int)oilSpots.size(), [this](int, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            OilSpot& spot = oilSpots[i];
+            spot.spawnFrame++;
+
+            // Fade in for first 20 frames, stay visible for 60, fade out
+            // for the next 20, then remove
+            if (spot.spawnFrame < 20) {
+                spot.alpha += 0.05f;
+                if (spot.alpha > 1.0f) spot.alpha = 1.0f;
+            } else if (spot.spawnFrame >= 100) {
+                removeFlags[i] = 1;
+            } else if (spot.spawnFrame >= 80) {
+                spot.alpha -= 0.05f;
+                if (spot.alpha < 0.0f) spot.alpha = 0.0f;
             }
         }
-        
-        // Re-render submarine on top of blackout
-        submarine.render(renderer);
-    }
+    });
+    eraseFlagged(oilSpots, removeFlags);
 }
 
-bool Level3::isPositionInBlackout(int x, int y) {
+bool Level::isPositionInBlackout(int x, int y) const {
     // No blackout if not active
     if (!isBlackout && !isBlackoutFading) {
         return false;
@@ -476,202 +462,57 @@ bool Level3::isPositionInBlackout(int x, int y) {
         return true;
     }
     
-    // Calculate wave offset for this y position
-    float wave1 = sin((y * 0.05f) + (blackoutCounter * 0.03f)) * 25.0f;
-    float wave2 = sin((y * 0.15f) + (blackoutCounter * 0.05f)) * 15.0f;
-    float wave3 = sin((y * 0.08f) - (blackoutCounter * 0.02f)) * 10.0f;
-    float wave = wave1 + wave2 + wave3;
+    // Wave offset for this y position (rows on screen come from the table)
+    int wave = (y >= 0 && y < (int)blackoutWaves.size()) ? blackoutWaves[y] : waveOffsetAt(y);
     
     if (isBlackoutFading) {
         // During fade: blackout is from x=0 to blackoutWidth+wave
-        int xEnd = blackoutWidth + static_cast<int>(wave);
+        int xEnd = blackoutWidth + wave;
         return x <= xEnd;
     } else {
         // During expansion: blackout is from 800-blackoutWidth+wave to right edge
-        int xStart = 800 - blackoutWidth + static_cast<int>(wave);
+        int xStart = 800 - blackoutWidth + wave;
         return x >= xStart;
     }
 }
 
-// Level 4: Superstorm Surge - Final level with timer
-Level4::Level4(SDL_Renderer* renderer,
-               const std::vector<SDL_Texture*>& litterTextures,
-               const std::vector<SDL_Texture*>& enemyTextures,
-               const std::vector<float>& enemySpeeds,
-               const std::vector<int>& enemyWidths,
-               const std::vector<int>& enemyHeights)
-    : Level3(renderer, litterTextures, enemyTextures, enemySpeeds, enemyWidths, enemyHeights),
-      stormTimer(1800),  // 60 seconds at 60 FPS
-      stormPulseCounter(0),
-      litterSpeedMultiplier(5.0f),
-      scrollOffset(0),
-      litterSpawnTimer(0),
-      storedLitterTextures(litterTextures)
-{
-    // More enemies for increased challenge in final level
-    maxActiveEnemies = 4;  // 4 enemies on screen
-    spawnInterval = 120;   // spawns every 2 seconds
-
-    float scale = 0.15f;   // choose your litter scale
-    for (auto tex : storedLitterTextures) {
-        int w = 0, h = 0;
-        SDL_QueryTexture(tex, NULL, NULL, &w, &h);
-        scaledWidths.push_back(int(w * scale));
-        scaledHeights.push_back(int(h * scale));
-    }
-    
-    // Clear all litter from base class and Level 3
-    litterItems.clear();
- }
-
-void Level4::update(Submarine& submarine, Scoreboard& scoreboard, int& lives, bool& gameOver) {
-    // Decrease timer
-    if (stormTimer > 0) {
-        stormTimer--;
-    }
-    
+// Superstorm litter flow (Level 4)
+void Level::updateLitterFlow(Submarine& submarine, std::vector<SimEvent>& events) {
     // Spawn new litter from the right side continuously
     litterSpawnTimer++;
-    if (litterSpawnTimer >= 10 && storedLitterTextures.size() >= 7) {  // Spawn every 0.17 seconds 
+    if (litterSpawnTimer >= 10 && scaledWidths.size() >= 7) {  // Spawn every 0.17 seconds 
         litterSpawnTimer = 0;
         // Spawn 2-3 pieces of litter at once for higher density
-        int spawnCount = 2 + (rand() % 2);  // 2 or 3 items
-        for (int i = 0; i < spawnCount; i++) {
-            int texIndex = rand() % 7;
-            int randomY = 50 + (rand() % 500);  // Keep within visible area
+        int spawnCount = litterRng.range(2, 4);  // 2 or 3 items
+        for (int i = 0; i < spawnCount && !litterFlow.full(); i++) {
+            int texIndex = litterRng.below(7);
+            int randomY = litterRng.range(50, 550);  // Keep within visible area
             float randomSpeed = 4.0f;// 1.5f + (rand() % 15) / 10.0f;  // Speed between 1.5 and 3.0
-            int randomX = 850 + (rand() % 100);  // Slight variation in spawn position
+            int randomX = litterRng.range(850, 950);  // Slight variation in spawn position
             
             int w = scaledWidths[texIndex];
             int h = scaledHeights[texIndex];
 
-            litterItems.emplace_back(
-                Litter(storedLitterTextures[texIndex], randomX, randomY, randomSpeed, w, h)
-            );
-        }
-    }
-    
-    // Update litter - continuous flow from right to left
-    for (auto& litter : litterItems) {
-        if (!litter.active) {
-            continue;
-        }
-        
-        // Move the litter left (continuous flow)
-        litter.x -= litter.speed;
-        
-        // Remove litter that goes off the left side
-        if (litter.x < -100) {
-            litter.active = false;
-        }
-        
-        // Check collision with submarine
-        if (litter.active && litter.checkCollision(submarine.getRect())) {
-            litter.active = false;
-            scoreboard.setScore(scoreboard.getScore() + 10);
+            litterFlow.add(SPRITE_CAN + texIndex, randomX, randomY, randomSpeed, w, h);
         }
     }
     
-    // Update enemies (with increased spawn rate from constructor)
-    updateEnemies(submarine, lives, gameOver);
-}
-
-// No ink mechanics in final level
-void Level4::updateBlackoutMechanic() {}
-
-void Level4::updateEnemies(Submarine& submarine, int& lives, bool& gameOver) {
-    // Spawn enemies periodically
-    spawnTimer++;
-    if (spawnTimer >= spawnInterval) {
-        spawnTimer = 0;
-        int activeCount = 0;
-        for (const auto& enemy : enemyItems) if (enemy.active) activeCount++;
-        if (activeCount < maxActiveEnemies && !enemyTextures.empty()) {
-            // Exclude octopus and shark from Level 4
-            int randomIndex;
-            do {
-                randomIndex = rand() % enemyTextures.size();
-            } while (randomIndex == 2 || randomIndex == 4);  // Skip octopus and shark
-            
-            float startX = 850;  // Start from right
-            float startY = rand() % 500 + 50;  // Random Y position
-            
-            // Speed up enemies to match fast litter flow 
-            float fastSpeed = enemySpeeds[randomIndex] * 3.0f;
-            enemyItems.emplace_back(enemyTextures[randomIndex], startX, startY, fastSpeed,
-                                   enemyWidths[randomIndex], enemyHeights[randomIndex], randomIndex);
-        }
+    // Update litter - continuous flow from right to left, and remove
+    // litter that goes off the left side
+    forEachChunk(litterFlow.size(), [this](int, int begin, int end) {
+        litterFlow.driftLeft(begin, end);
+        litterFlow.deactivateLeftOf(-100, begin, end);
+    });
+
+    // Check collision with submarine
+    syncFlowGrid();
+    litterGrid.queryRect(submarine.getRect(), gridHits);
+    std::sort(gridHits.begin(), gridHits.end());  // Same order as walking the store
+    for (int index : gridHits) {
+        litterFlow.flags[index] &= uint8_t(~EntityStore::FLAG_ACTIVE);
+        events.push_back({ SimEventType::LitterCollected, 10 });
     }
 
-    // Update enemies (same as base class)
-    SDL_Rect subRect = submarine.getRect();
-    float subX = subRect.x + subRect.w / 2.0f;
-    float subY = subRect.y + subRect.h / 2.0f;
-    
-    for (auto it = enemyItems.begin(); it != enemyItems.end();) {
-        bool offScreen = it->x < -100 || (it->y > 600 && it->falling);
-        
-        if (offScreen) {
-            it = enemyItems.erase(it);
-        } else {
-            it->update(subX, subY);
-            if (it->checkCollision(submarine.getRect()) && !it->falling) {
-                lives--;
-                submarine.startHitBlink();
-                it->startHitBlink();
-                it->startFalling();
-                if (animalCollisionSound) {
-                    Mix_PlayChannel(-1, animalCollisionSound, 0);
-                }
-                if (lives <= 0) gameOver = true;
-                ++it;
-            } else ++it;
-        }
-    }
-}
-
-// Render regular litter and enemies
-void Level4::render() {
-    Level::render();
-}
-
-void Level4::renderBlackoutEffects(Submarine& submarine) {
-    
-    // Storm timer
-    TTF_Font* timerFont = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 24);
-    if (timerFont) {
-        int seconds = stormTimer / 60;
-        int minutes = seconds / 60;
-        seconds = seconds % 60;
-        
-        char timerText[32];
-        snprintf(timerText, sizeof(timerText), "Timer: %d:%02d", minutes, seconds);
-        
-        // Timer color: green -> yellow -> red as time runs out
-        SDL_Color timerColor;
-        if (stormTimer > 1800) {  // > 30 seconds
-            timerColor = {0, 255, 0, 255};  // Green
-        } else if (stormTimer > 600) {  // > 10 seconds
-            timerColor = {255, 255, 0, 255};  // Yellow
-        } else {
-            timerColor = {255, 0, 0, 255};  // Red
-        }
-        
-        SDL_Surface* timerSurf = TTF_RenderText_Blended(timerFont, timerText, timerColor);
-        if (timerSurf) {
-            SDL_Texture* timerTex = SDL_CreateTextureFromSurface(renderer, timerSurf);
-            if (timerTex) {
-                SDL_Rect timerRect = {
-                    10,
-                    50,
-                    timerSurf->w,
-                    timerSurf->h
-                };
-                SDL_RenderCopy(renderer, timerTex, NULL, &timerRect);
-                SDL_DestroyTexture(timerTex);
-            }
-            SDL_FreeSurface(timerSurf);
-        }
-        TTF_CloseFont(timerFont);
-    }
+    // Recycle the slots
+    litterFlow.removeInactive();
 }
@@ -0,0 +1,199 @@
+#include "LevelRenderer.h"
+#include "FontManager.h"
+#include "RenderStats.h"
+#include <cmath>
+#include <cstdio>
+
+LevelRenderer::LevelRenderer(SDL_Renderer* renderer_, const SpriteAtlas& atlas_)
+    : renderer(renderer_), atlas(atlas_), batch(renderer_)
+{
+    timerText = new TextRenderer(renderer, FontManager::get(UI_FONT_PATH, 24));
+}
+
+LevelRenderer::~LevelRenderer() {
+    delete timerText;
+}
+
+void LevelRenderer::queueSprite(int sprite, SpriteAtlas::Variant variant, const SDL_Rect& dest, SDL_Color color) {
+    const SDL_Rect* src = atlas.getRegion(sprite, variant);
+    if (src) batch.draw(atlas.getTexture(), *src, dest, color);
+}
+
+void LevelRenderer::render(const Level& level) {
+    // Litter then enemies, submitted together
+    for (const auto& litter : level.getLitterItems()) queueLitter(litter);
+
+    const EntityStore& flow = level.getLitterFlow();
+    for (int i = 0; i < flow.size(); i++) {
+        SDL_Rect dest = { (int)flow.x[i], (int)flow.y[i], flow.width[i], flow.height[i] };
+        queueSprite(flow.sprite[i], SpriteAtlas::NORMAL, dest);
+    }
+    for (const auto& e : level.getEnemyItems()) queueEnemy(e);
+    batch.flush();
+}
+
+void LevelRenderer::queueLitter(const Litter& litter) {
+    if (!litter.active) return;
+    SDL_Rect dest = { (int)litter.x, (int)litter.y, litter.getWidth(), litter.getHeight() };
+    queueSprite(litter.sprite, SpriteAtlas::NORMAL, dest);
+}
+
+void LevelRenderer::queueEnemy(const Enemies& enemy) {
+    if (!enemy.active) return;
+
+    // Blink red if recently hit 
+    bool tinted = enemy.hitBlinkTimer > 0 && (enemy.hitBlinkTimer / 3) % 2 == 0;
+
+    // Flip shark sprite based on facing direction
+    bool flipped = enemy.enemyType == 4 && enemy.facingRight;
+
+    SpriteAtlas::Variant variant = flipped ? (tinted ? SpriteAtlas::FLIPPED_TINTED : SpriteAtlas::FLIPPED)
+                                           : (tinted ? SpriteAtlas::TINTED : SpriteAtlas::NORMAL);
+    SDL_Rect dest = { static_cast<int>(enemy.x), static_cast<int>(enemy.y), enemy.width, enemy.height };
+    queueSprite(enemy.sprite, variant, dest);
+}
+
+void LevelRenderer::renderSubmarine(const Submarine& submarine) {
+    int hitBlinkTimer = submarine.getHitBlinkTimer();
+
+    // Blink red if recently hit (alternating every 3 frames)
+    bool tinted = hitBlinkTimer > 0 && (hitBlinkTimer / 3) % 2 == 0;
+
+    // Flip based on facing direction
+    bool flipped = submarine.isFacingRight();
+
+    SpriteAtlas::Variant variant = flipped ? (tinted ? SpriteAtlas::FLIPPED_TINTED : SpriteAtlas::FLIPPED)
+                                           : (tinted ? SpriteAtlas::TINTED : SpriteAtlas::NORMAL);
+    SimRect r = submarine.getRect();
+    SDL_Rect rect = { r.x, r.y, r.w, r.h };
+    queueSprite(submarine.getSprite(), variant, rect);
+    batch.flush();
+}
+
+void LevelRenderer::renderHearts(int lives) {
+    int heartSizeX = 40;
+    int heartSizeY = 35;
+    int spacing = 5;
+    int startX = 5;
+    int startY = 5;
+    for (int i = 0; i < lives; ++i) {
+        SDL_Rect heartRect = { startX + i * (heartSizeX + spacing), startY, heartSizeX, heartSizeY };
+        queueSprite(SPRITE_HEART, SpriteAtlas::NORMAL, heartRect);
+    }
+    batch.flush();
+}
+
+void LevelRenderer::renderBlackoutEffects(const Level& level, const Submarine& submarine) {
+    // Level 4 only shows its timer (ink mechanics are disabled there)
+    if (level.hasStorm()) {
+        renderStormTimer(level);
+    } else if (level.hasBlackout()) {
+        renderInkAndBlackout(level, submarine);
+    }
+}
+
+void LevelRenderer::renderInkAndBlackout(const Level& level, const Submarine& submarine) {
+    // Show ink spots with fade-in effect (alpha goes in the vertex color)
+    for (const auto& spot : level.getOilSpots()) {
+        if (spot.alpha > 0.0f) {
+            SDL_Color inkColor = { 255, 255, 255, static_cast<Uint8>(spot.alpha * 240) };  // Max 240 for darker ink
+            SDL_Rect inkRect = { spot.x, spot.y, spot.size, spot.size };
+            queueSprite(SPRITE_OIL, SpriteAtlas::NORMAL, inkRect, inkColor);
+        }
+    }
+    batch.flush();
+
+    bool isBlackoutFading = level.isBlackoutFadingOut();
+    int blackoutWidth = level.getBlackoutWidth();
+    
+    // Full blackout overlay - expands from right edge with wavy border
+    if (level.isInBlackout() || isBlackoutFading) {
+        RenderStats::setBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        RenderStats::setDrawColor(renderer, 0, 0, 0, 200);
+        
+        // If blackout has fully expanded and not fading, just fill the entire screen
+        if (blackoutWidth >= 800 && !isBlackoutFading) {
+            SDL_Rect fullScreen = {0, 0, 800, 600};
+            RenderStats::fillRect(renderer, &fullScreen);
+        } else {
+            // Wavy, irregular edge: the level already worked out the wave
+            // offset for each row this tick. Rows become quads (neighbouring
+            // rows with the same edge share one) in a single mesh.
+            const std::vector<int>& waves = level.getBlackoutWaves();
+            const SDL_Color shade = { 0, 0, 0, 200 };
+            blackoutVertices.clear();
+            blackoutIndices.clear();
+
+            const int rows = (int)waves.size();
+            int runStart = 0, runX0 = 0, runX1 = 0;
+            for (int y = 0; y <= rows; y++) {
+                int x0 = 0, x1 = 0;
+                if (y < rows) {
+                    if (isBlackoutFading) {
+                        x0 = 0;
+                        x1 = blackoutWidth + waves[y];
+                        // Clamp to screen bounds
+                        if (x1 < 0) x1 = 0;
+                        if (x1 > 800) x1 = 800;
+                    } else {
+                        x0 = 800 - blackoutWidth + waves[y];
+                        // Clamp to screen bounds to prevent drawing outside the window
+                        if (x0 < 0) x0 = 0;
+                        if (x0 > 800) x0 = 800;
+                        x1 = 800;
+                    }
+                    if (y > 0 && x0 == runX0 && x1 == runX1) continue;
+                }
+
+                // Edge moved (or we ran out of rows): close the previous run
+                if (y > 0 && runX1 > runX0) {
+                    int base = int(blackoutVertices.size());
+                    blackoutVertices.push_back({ { float(runX0), float(runStart) }, shade, { 0, 0 } });
+                    blackoutVertices.push_back({ { float(runX1), float(runStart) }, shade, { 0, 0 } });
+                    blackoutVertices.push_back({ { float(runX1), float(y) }, shade, { 0, 0 } });
+                    blackoutVertices.push_back({ { float(runX0), float(y) }, shade, { 0, 0 } });
+                    int quad[6] = { base, base + 1, base + 2, base, base + 2, base + 3 };
+                    blackoutIndices.insert(blackoutIndices.end(), quad, quad + 6);
+                }
+                runStart = y;
+                runX0 = x0;
+                runX1 = x1;
+            }
+
+            if (!blackoutVertices.empty()) {
+                RenderStats::geometry(renderer, nullptr,
+                                   blackoutVertices.data(), int(blackoutVertices.size()),
+                                   blackoutIndices.data(), int(blackoutIndices.size()));
+            }
+        }
+        
+        // Re-render submarine on top of blackout
+        renderSubmarine(submarine);
+    }
+}
+
+void LevelRenderer::renderStormTimer(const Level& level) {
+    int stormTimer = level.getStormTimer();
+
+    // Storm timer
+    if (timerText->isLoaded()) {
+        int seconds = stormTimer / 60;
+        int minutes = seconds / 60;
+        seconds = seconds % 60;
+        
+        char timerLabel[32];
+        snprintf(timerLabel, sizeof(timerLabel), "Timer: %d:%02d", minutes, seconds);
+        
+        // Timer color: green -> yellow -> red as time runs out
+        SDL_Color timerColor;
+        if (stormTimer > 1800) {  // > 30 seconds
+            timerColor = {0, 255, 0, 255};  // Green
+        } else if (stormTimer > 600) {  // > 10 seconds
+            timerColor = {255, 255, 0, 255};  // Yellow
+        } else {
+            timerColor = {255, 0, 0, 255};  // Red
+        }
+        
+        timerText->draw(timerLabel, 10, 50, timerColor);
+    }
+}
@@ -1,25 +1,31 @@
 #include "Litter.h"
-#include <cstdlib>
 
-Litter::Litter(SDL_Texture* tex, float startX, float startY, float moveSpeed, int w, int h)
-    : texture(tex), x(startX), y(startY), speed(moveSpeed), 
+Litter::Litter(int sprite_, float startX, float startY, float moveSpeed, int w, int h)
+    : sprite(sprite_), x(startX), y(startY), speed(moveSpeed), 
       active(true), respawnTimer(0), width(w), height(h)
 {
 }
 
 
-bool Litter::update() {
+bool Litter::update(Rng& rng) {
+    Step step = advance();
+    if (step != STEP_NONE) {
+        respawn(rng);
+    }
+    return step == STEP_WRAPPED;
+}
+
+Litter::Step Litter::advance() {
     if (!active) {
         // Countdown until respawn
         if (respawnTimer > 0) {
             respawnTimer--;
-        } else {
-            // Reactivate once timer hits zero
-            active = true;
-            x = 850; // respawn just off-screen to the right
-            y = rand() % 500 + 50;
+            return STEP_NONE;
         }
-        return false; // no miss while inactive
+        // Reactivate once timer hits zero
+        active = true;
+        x = 850; // respawn just off-screen to the right
+        return STEP_RESPAWNED; // no miss while inactive
     }
 
     // Move leftward
@@ -28,25 +34,19 @@ bool Litter::update() {
     // Wrap around if it goes off the left edge
     if (x < -100) {
         x = 850; // loop back to the right
-        y = rand() % 500 + 50; // random vertical drift
-        return true; // missed the submarine
+        return STEP_WRAPPED; // missed the submarine
     }
-    return false;
+    return STEP_NONE;
 }
 
-void Litter::render(SDL_Renderer* renderer) {
-    if (!active) return;
-    SDL_Rect dest = { (int)x, (int)y, width, height };
-    SDL_RenderCopy(renderer, texture, nullptr, &dest);
+void Litter::respawn(Rng& rng) {
+    y = rng.range(50, 550); // random vertical drift
 }
 
-bool Litter::checkCollision(const SDL_Rect& subRect) {
+bool Litter::checkCollision(const SimRect& subRect) {
     if (!active) return false;
-    SDL_Rect litterRect = { (int)x, (int)y, width, height };
-    return (subRect.x < litterRect.x + litterRect.w &&
-            subRect.x + subRect.w > litterRect.x &&
-            subRect.y < litterRect.y + litterRect.h &&
-            subRect.y + subRect.h > litterRect.y);
+    SimRect litterRect = { (int)x, (int)y, width, height };
+    return rectsOverlap(subRect, litterRect);
 }
 
 void Litter::collect() {
@@ -1,6 +1,9 @@
 #include "Menu.hpp"
 #include <SDL_image.h>
 #include <cmath>
+#include "AssetCache.h"
+#include "FontManager.h"
+#include "RenderStats.h"
 
 const int WINDOW_WIDTH = 800;
 const int WINDOW_HEIGHT = 600;
@@ -34,11 +37,8 @@ Menu::Menu(SDL_Renderer* renderer)
     if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
         std::cerr << "SDL_mixer could not initialize! Mix_Error: " << Mix_GetError() << std::endl;
     } else {
-        // Load menu background music
-        menuMusic = Mix_LoadMUS("Assets/music/seaside_village.wav");
-        if (!menuMusic) {
-            std::cerr << "Failed to load menu music! Mix_Error: " << Mix_GetError() << std::endl;
-        }
+        // Load menu background music (cached, so only the first menu reads it)
+        menuMusic = AssetCache::acquireMusic("Assets/music/seaside_village.wav");
         
         // Play menu music on loop
         if (menuMusic) {
@@ -47,54 +47,28 @@ Menu::Menu(SDL_Renderer* renderer)
         }
     }
 
-    chatFont = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 22);
-    if (!chatFont) {
-        std::cerr << "Failed to load UI font: " << TTF_GetError() << std::endl;
-    }
+    // Fonts are shared and owned by FontManager
+    chatFont = FontManager::get(UI_FONT_PATH, 22);
+    titleFont = FontManager::get(UI_FONT_PATH, 50);
+    font = FontManager::get(UI_FONT_PATH, 40);
 
-    titleFont = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 50);
-    if (!titleFont) {
-        std::cerr << "Failed to load title font: " << TTF_GetError() << std::endl;
-    }
-        
-    // Load font 
-    font = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 40);
-    if (!font) {
-        std::cerr << "Failed to load font: " << TTF_GetError() << std::endl;
-    }
+    // Smaller font for instructions text
+    instructionsFont = FontManager::get(UI_FONT_PATH, 28);
 
-    if (!chatFont) std::cerr << "UI font failed: " << TTF_GetError() << "\n";
+    itemText = new TextRenderer(renderer, font);
+    titleText = new TextRenderer(renderer, titleFont);
+    chatText = new TextRenderer(renderer, chatFont);
+    instructionsText = new TextRenderer(renderer, instructionsFont);
 
     // CREATE CHAT
     chat = new ChatUI(renderer, chatFont);
 
     chat->loadSonar("Assets/sonar.png");
 
-    // Load main menu background
-    SDL_Surface* menuSurface = IMG_Load("Assets/backgrounds/menu_background.png");
-    if (!menuSurface) {
-        std::cerr << "Failed to load menu background: " << IMG_GetError() << std::endl;
-    } else {
-        menuBackgroundTexture = SDL_CreateTextureFromSurface(renderer, menuSurface);
-        SDL_FreeSurface(menuSurface);
-    }
-
-    // Load instructions background 
-    SDL_Surface* instructionsSurface = IMG_Load("Assets/backgrounds/instructions_background.png");
-    if (!instructionsSurface) {
-        std::cerr << "Failed to load instructions background: " << IMG_GetError() << std::endl;
-    } else {
-        instructionsBackgroundTexture = SDL_CreateTextureFromSurface(renderer, instructionsSurface);
-        SDL_FreeSurface(instructionsSurface);
-    }
-
-    SDL_Surface* bgSurf = IMG_Load("Assets/backgrounds/chat_background.png");
-    if (!bgSurf) {
-        std::cerr << "Failed to load chat BG: " << IMG_GetError() << std::endl;
-    } else {
-        chatBGTexture = SDL_CreateTextureFromSurface(renderer, bgSurf);
-        SDL_FreeSurface(bgSurf);
-    }
+    // Backgrounds (menu, instructions, chat)
+    menuBackgroundTexture = AssetCache::acquireTexture(renderer, "Assets/backgrounds/menu_background.png");
+    instructionsBackgroundTexture = AssetCache::acquireTexture(renderer, "Assets/backgrounds/instructions_background.png");
+    chatBGTexture = AssetCache::acquireTexture(renderer, "Assets/backgrounds/chat_background.png");
 
 
     // Define menu options
@@ -104,14 +78,18 @@ Menu::Menu(SDL_Renderer* renderer)
 
 // Destructor
 Menu::~Menu() {
-    if (menuBackgroundTexture) SDL_DestroyTexture(menuBackgroundTexture);
-    if (instructionsBackgroundTexture) SDL_DestroyTexture(instructionsBackgroundTexture);
-    if (font) TTF_CloseFont(font);
+    AssetCache::release(menuBackgroundTexture);
+    AssetCache::release(instructionsBackgroundTexture);
+    AssetCache::release(chatBGTexture);
+    delete itemText;
+    delete titleText;
+    delete chatText;
+    delete instructionsText;
     
-    // Stop and free menu music
+    // Stop menu music (the cache keeps it for the next menu)
     if (menuMusic) {
         Mix_HaltMusic();
-        Mix_FreeMusic(menuMusic);
+        AssetCache::release(menuMusic);
         menuMusic = nullptr;
     }
     delete chat;
@@ -172,17 +150,8 @@ void Menu::handleEvent(const SDL_Event& e, bool& running, bool& startGame) {
         int startY = (WINDOW_HEIGHT - totalMenuHeight) / 2 + 60;
 
         for (int i = 0; i < items.size(); i++) {
-            SDL_Surface* ts = TTF_RenderText_Blended(font, items[i].c_str(), {255,255,255});
-
-        if (!ts) {
-            std::cerr << "TTF_RenderText_Blended failed: " << TTF_GetError() << std::endl;
-            continue;  // prevent crash
-        }
-
-        int textW = ts->w;
-        int textH = ts->h;
-
-        SDL_FreeSurface(ts);
+            int textW = 0, textH = 0;
+            itemText->measure(items[i], &textW, &textH);
 
 
             int xPos = (WINDOW_WIDTH - textW) / 2;
@@ -227,10 +196,10 @@ void Menu::render()
     if (briefingActive) {
     // Draw the ORANGE background behind everything
     if (chatBGTexture)
-        SDL_RenderCopy(renderer, chatBGTexture, NULL, NULL);
+        RenderStats::copy(renderer, chatBGTexture, NULL, NULL);
     else {
-        SDL_SetRenderDrawColor(renderer, 10, 25, 60, 255);
-        SDL_RenderClear(renderer);
+        RenderStats::setDrawColor(renderer, 10, 25, 60, 255);
+        RenderStats::clear(renderer);
     }
 
     // Draw the chat UI in front
@@ -241,7 +210,7 @@ void Menu::render()
 
 
     // OTHERWISE, normal main menu
-    SDL_RenderCopy(renderer, menuBackgroundTexture, NULL, NULL);
+    RenderStats::copy(renderer, menuBackgroundTexture, NULL, NULL);
 
     if (showInstructions) {
         renderInstructions();
@@ -254,17 +223,17 @@ void Menu::render()
 void Menu::renderMainMenu() {
 
     if (menuBackgroundTexture) {
-    SDL_RenderCopy(renderer, menuBackgroundTexture, nullptr, nullptr);
+    RenderStats::copy(renderer, menuBackgroundTexture, nullptr, nullptr);
     } else {
-        SDL_SetRenderDrawColor(renderer, 10, 25, 60, 255);
-        SDL_RenderClear(renderer);
+        RenderStats::setDrawColor(renderer, 10, 25, 60, 255);
+        RenderStats::clear(renderer);
     }
 
     // DARKEN OVERLAY
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 40);   // adjust 120 for desired effect
+    RenderStats::setDrawColor(renderer, 0, 0, 0, 40);   // adjust 120 for desired effect
     SDL_Rect overlay = {0, 0, WINDOW_WIDTH, WINDOW_HEIGHT};
-    SDL_RenderFillRect(renderer, &overlay);
+    RenderStats::fillRect(renderer, &overlay);
 
     // WELCOME TITLE 
     float t = SDL_GetTicks() / 1000.0f;
@@ -280,40 +249,20 @@ void Menu::renderMainMenu() {
 
 
     // Glow background for title 
-    SDL_Color glowColor = {80, 160, 255, 180}; // ocean blue glow
-    SDL_Surface* glowSurf = TTF_RenderText_Blended(titleFont, "Welcome to TideSweepers", glowColor);
-    SDL_Texture* glowTex = SDL_CreateTextureFromSurface(renderer, glowSurf);
-
-    SDL_Rect glowRect = {
-        (WINDOW_WIDTH - glowSurf->w) / 2 - 3,
-        titleY - 3,
-        glowSurf->w + 6,
-        glowSurf->h + 6
-    };
+    const std::string title = "Welcome to TideSweepers";
+    int titleW = 0, titleH = 0;
+    titleText->measure(title, &titleW, &titleH);
+    int titleX = (WINDOW_WIDTH - titleW) / 2;
 
-    SDL_RenderCopy(renderer, glowTex, nullptr, &glowRect);
-
-    SDL_FreeSurface(glowSurf);
-    SDL_DestroyTexture(glowTex);
-
-    if (titleFont) {
-        SDL_Color titleColor = {255, 255, 255, 255}; // bright white
-        
-        SDL_Surface* surf = TTF_RenderText_Blended(titleFont, "Welcome to TideSweepers", titleColor);
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-
-        SDL_Rect pos = {
-            (WINDOW_WIDTH - surf->w) / 2,
-            titleY,  // <-- adjust this to move up or down
-            surf->w,
-            surf->h
-        };
+    // Glow: the title drawn 3px out in each diagonal
+    SDL_Color glowColor = {80, 160, 255, 180}; // ocean blue glow
+    titleText->draw(title, titleX - 3, titleY - 3, glowColor);
+    titleText->draw(title, titleX + 3, titleY - 3, glowColor);
+    titleText->draw(title, titleX - 3, titleY + 3, glowColor);
+    titleText->draw(title, titleX + 3, titleY + 3, glowColor);
 
-        SDL_RenderCopy(renderer, tex, nullptr, &pos);
-
-        SDL_FreeSurface(surf);
-        SDL_DestroyTexture(tex);
-    }
+    SDL_Color titleColor = {255, 255, 255, 255}; // bright white
+    titleText->draw(title, titleX, titleY, titleColor);  // <-- adjust titleY to move up or down
 
     // Vertical layout settings
     const int buttonSpacing = 90;  // distance between button centers
@@ -328,11 +277,8 @@ void Menu::renderMainMenu() {
         SDL_Color color = {220, 240, 255, 255}; // soft white-blue text
         if (i == hoveredIndex) color = {255, 210, 80, 255}; // warm gold when hovered
 
-        SDL_Surface* textSurface = TTF_RenderText_Blended(font, items[i].c_str(), color);
-        SDL_Texture* textTex = SDL_CreateTextureFromSurface(renderer, textSurface);
-
-        int textW, textH;
-        SDL_QueryTexture(textTex, nullptr, nullptr, &textW, &textH);
+        int textW = 0, textH = 0;
+        itemText->measure(items[i], &textW, &textH);
 
         // Centered positions 
         int xPos = (WINDOW_WIDTH - textW) / 2;
@@ -348,22 +294,18 @@ void Menu::renderMainMenu() {
 
         //  Button background color
         if (i == hoveredIndex)
-            SDL_SetRenderDrawColor(renderer, 100, 200, 255, 160);  // aqua glow
+            RenderStats::setDrawColor(renderer, 100, 200, 255, 160);  // aqua glow
         else
-            SDL_SetRenderDrawColor(renderer, 25, 55, 100, 180);    // dark navy
+            RenderStats::setDrawColor(renderer, 25, 55, 100, 180);    // dark navy
 
-        SDL_RenderFillRect(renderer, &buttonRect);
+        RenderStats::fillRect(renderer, &buttonRect);
 
         // Border
-        SDL_SetRenderDrawColor(renderer, 180, 230, 255, 200);
-        SDL_RenderDrawRect(renderer, &buttonRect);
+        RenderStats::setDrawColor(renderer, 180, 230, 255, 200);
+        RenderStats::drawRect(renderer, &buttonRect);
 
         // Render text centered in button
-        SDL_Rect dst = {xPos, yPos, textW, textH};
-        SDL_RenderCopy(renderer, textTex, nullptr, &dst);
-
-        SDL_FreeSurface(textSurface);
-        SDL_DestroyTexture(textTex);
+        itemText->draw(items[i], xPos, yPos, color);
         }
 }
 
@@ -371,52 +313,31 @@ void Menu::renderMainMenu() {
 void Menu::renderInstructions() {
     // Background setup
     if (instructionsBackgroundTexture) {
-    SDL_RenderCopy(renderer, instructionsBackgroundTexture, nullptr, nullptr);
+    RenderStats::copy(renderer, instructionsBackgroundTexture, nullptr, nullptr);
     } else {
-    SDL_SetRenderDrawColor(renderer, 15, 40, 90, 255);
-    SDL_RenderClear(renderer);
+    RenderStats::setDrawColor(renderer, 15, 40, 90, 255);
+    RenderStats::clear(renderer);
     }
 
 
-    // Use a smaller font for instructions text
-    TTF_Font* smallFont = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 28); // Smaller font size
-    if (!smallFont) {
-        std::cerr << "Failed to load small font: " << TTF_GetError() << std::endl;
-        return;
-    }
-
     // Text color
     SDL_Color white = {255, 255, 255, 255};
 
     // Cute intro text
-    SDL_Surface* textSurface = TTF_RenderText_Blended_Wrapped(
-        smallFont,
+    const std::string text =
         "The sea needs your help!\n\n"
         "Use the arrow keys to steer your submarine through the waves.\n\n"
         "Swim close to litter to collect it and keep the ocean clean!\n\n"
-        "Press ESC anytime to get back to the main menu.",
-        white, 600);
-
-    SDL_Texture* textTex = SDL_CreateTextureFromSurface(renderer, textSurface);
+        "Press ESC anytime to get back to the main menu.";
 
     int textW = 0, textH = 0;
-    SDL_QueryTexture(textTex, nullptr, nullptr, &textW, &textH);
+    instructionsText->measureWrapped(text, 600, &textW, &textH);
 
     // Center the text nicely on screen
-    SDL_Rect dst = {
+    instructionsText->drawWrapped(text,
         (WINDOW_WIDTH - textW) / 2,
         (WINDOW_HEIGHT - textH) / 2,
-        textW,
-        textH
-    };
-
-    // Render to screen
-    SDL_RenderCopy(renderer, textTex, nullptr, &dst);
-
-    // Cleanup
-    SDL_FreeSurface(textSurface);
-    SDL_DestroyTexture(textTex);
-    TTF_CloseFont(smallFont); //  Close small font after use
+        white, 600);
 }
 
 void Menu::startBriefing() {
@@ -428,37 +349,25 @@ void Menu::startBriefing() {
 void Menu::renderNameEntry() {
 
     // Sonar background
-    SDL_SetRenderDrawColor(renderer, 5, 20, 40, 255);
-    SDL_RenderFillRect(renderer, &radioRect);
+    RenderStats::setDrawColor(renderer, 5, 20, 40, 255);
+    RenderStats::fillRect(renderer, &radioRect);
 
-    SDL_SetRenderDrawColor(renderer, 0, 40, 70, 255);
+    RenderStats::setDrawColor(renderer, 0, 40, 70, 255);
     for (int y = radioRect.y; y < radioRect.y + radioRect.h; y += 6) {
-        SDL_RenderDrawLine(renderer, radioRect.x, y, radioRect.x + radioRect.w, y);
+        RenderStats::drawLine(renderer, radioRect.x, y, radioRect.x + radioRect.w, y);
     }
 
     // Prompt text
     SDL_Rect promptRect = { radioRect.x + 20, radioRect.y + 20, 600, 40 };
-    SDL_Texture* promptTex = renderText("Enter your pilot name:", sonarTextColor, promptRect);
-    if (promptTex) {
-        SDL_RenderCopy(renderer, promptTex, NULL, &promptRect);
-        SDL_DestroyTexture(promptTex);
-    }
+    renderText("Enter your pilot name:", sonarTextColor, promptRect);
 
     // Typed name (SAFE even if empty)
     SDL_Rect nameRect = { radioRect.x + 20, radioRect.y + 80, 600, 40 };
-    SDL_Texture* nameTex = renderText(playerName, sonarTextColor, nameRect);
-    if (nameTex) {
-        SDL_RenderCopy(renderer, nameTex, NULL, &nameRect);
-        SDL_DestroyTexture(nameTex);
-    }
+    renderText(playerName, sonarTextColor, nameRect);
 
     // Hint text
     SDL_Rect hintRect = { radioRect.x + 20, radioRect.y + 150, 600, 40 };
-    SDL_Texture* hintTex = renderText("(Press ENTER to continue)", sonarHintColor, hintRect);
-    if (hintTex) {
-        SDL_RenderCopy(renderer, hintTex, NULL, &hintRect);
-        SDL_DestroyTexture(hintTex);
-    }
+    renderText("(Press ENTER to continue)", sonarHintColor, hintRect);
 }
 
 
@@ -466,27 +375,24 @@ void Menu::renderBriefingChoices() {
 
 std::cout << "[Menu] startBriefing() triggered\n";
 
-    SDL_SetRenderDrawColor(renderer, 5, 20, 40, 255);
-    SDL_RenderFillRect(renderer, &radioRect);
+    RenderStats::setDrawColor(renderer, 5, 20, 40, 255);
+    RenderStats::fillRect(renderer, &radioRect);
 
-    SDL_SetRenderDrawColor(renderer, 0, 40, 70, 255);
+    RenderStats::setDrawColor(renderer, 0, 40, 70, 255);
     for (int y = radioRect.y; y < radioRect.y + radioRect.h; y += 6) {
-        SDL_RenderDrawLine(renderer, radioRect.x, y, radioRect.x + radioRect.w, y);
+        RenderStats::drawLine(renderer, radioRect.x, y, radioRect.x + radioRect.w, y);
     }
 
     std::string q = "[CMD] Understood, Pilot " + playerName + ". Your response?";
 
     SDL_Rect qRect = { radioRect.x + 20, radioRect.y + 20, 640, 40 };
-    SDL_Texture* qTex = renderText(q, sonarTextColor, qRect, true);
-    if (qTex) { SDL_RenderCopy(renderer, qTex, NULL, &qRect); SDL_DestroyTexture(qTex); }
+    renderText(q, sonarTextColor, qRect, true);
 
     SDL_Rect aRect = { radioRect.x + 20, radioRect.y + 120, 640, 40 };
-    SDL_Texture* aTex = renderText("A) " + choiceA, sonarTextColor, aRect, true);
-    if (aTex) { SDL_RenderCopy(renderer, aTex, NULL, &aRect); SDL_DestroyTexture(aTex); }
+    renderText("A) " + choiceA, sonarTextColor, aRect, true);
 
     SDL_Rect bRect = { radioRect.x + 20, radioRect.y + 180, 640, 40 };
-    SDL_Texture* bTex = renderText("B) " + choiceB, sonarTextColor, bRect, true);
-    if (bTex) { SDL_RenderCopy(renderer, bTex, NULL, &bRect); SDL_DestroyTexture(bTex); }
+    renderText("B) " + choiceB, sonarTextColor, bRect, true);
 }
 
 
@@ -512,59 +418,39 @@ void Menu::renderBriefing() {
     }
 
     // Sonar radio panel background
-    SDL_SetRenderDrawColor(renderer, 5, 20, 40, 255);
-    SDL_RenderFillRect(renderer, &radioRect);
+    RenderStats::setDrawColor(renderer, 5, 20, 40, 255);
+    RenderStats::fillRect(renderer, &radioRect);
 
     // sonar scanlines
-    SDL_SetRenderDrawColor(renderer, 0, 40, 70, 255);
+    RenderStats::setDrawColor(renderer, 0, 40, 70, 255);
     for (int y = radioRect.y; y < radioRect.y + radioRect.h; y += 6) {
-        SDL_RenderDrawLine(renderer, radioRect.x, y, radioRect.x + radioRect.w, y);
+        RenderStats::drawLine(renderer, radioRect.x, y, radioRect.x + radioRect.w, y);
     }
 
     // Message text
     SDL_Rect msgRect = { radioRect.x + 20, radioRect.y + 20, radioRect.w - 40, 200 };
-    SDL_Texture* msgTex = renderText(visibleMessage, sonarTextColor, msgRect, true);
-    if (msgTex) {
-        SDL_RenderCopy(renderer, msgTex, NULL, &msgRect);
-        SDL_DestroyTexture(msgTex);
-    }
+    renderText(visibleMessage, sonarTextColor, msgRect, true);
 
     // Continue indicator
     if (!isTyping) {
         SDL_Rect r = { radioRect.x + 20, radioRect.y + radioRect.h - 40, 400, 40 };
-        SDL_Texture* t = renderText("► Click to continue", sonarHintColor, r);
-        if (t) {
-            SDL_RenderCopy(renderer, t, NULL, &r);
-            SDL_DestroyTexture(t);
-        }
+        renderText("► Click to continue", sonarHintColor, r);
     }
 }
 
 
-SDL_Texture* Menu::renderText(const std::string& msg, SDL_Color color, SDL_Rect& dst, bool wrap)
+void Menu::renderText(const std::string& msg, SDL_Color color, SDL_Rect& dst, bool wrap)
 {
-    if (!chatFont) return nullptr;
-
-    if (msg.empty()) return nullptr;
+    if (!chatFont) return;
 
-    SDL_Surface* surf = nullptr;
+    if (msg.empty()) return;
 
     if (wrap) {
         int wrapWidth = dst.w;   // use width only
-        surf = TTF_RenderText_Blended_Wrapped(chatFont, msg.c_str(), color, wrapWidth);
-        dst.h = surf->h;
+        chatText->measureWrapped(msg, wrapWidth, &dst.w, &dst.h);
+        chatText->drawWrapped(msg, dst.x, dst.y, color, wrapWidth);
     } else {
-        surf = TTF_RenderText_Blended(chatFont, msg.c_str(), color);
+        chatText->measure(msg, &dst.w, &dst.h);
+        chatText->draw(msg, dst.x, dst.y, color);
     }
-
-    if (!surf) return nullptr;
-
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-    dst.w = surf->w;
-    dst.h = surf->h;
-
-    SDL_FreeSurface(surf);
-    return tex;
-}
-
-
+}
\ No newline at end of file
@@ -3,24 +3,22 @@
 #include <SDL_ttf.h>
 #include <SDL_image.h> 
 #include <iostream>
+#include "AssetCache.h"
+#include "FontManager.h"
+#include "RenderStats.h"
 
 Messages::Messages(SDL_Renderer* renderer)
     : renderer(renderer)
 {
-    font = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 20);
-    if (!font) {
-        std::cerr << "Failed to load message font OpenSans.ttf\n";
-    }
+    font = FontManager::get(UI_FONT_PATH, 20);
+    textRenderer = new TextRenderer(renderer, font);
 
-    radioTexture = IMG_LoadTexture(renderer, "Assets/Radio.png");
-    if (!radioTexture)
-        std::cout << "Failed to load Radio.png\n";
+    radioTexture = AssetCache::acquireTexture(renderer, "Assets/Radio.png");
 }
 
 Messages::~Messages() {
-    if (currentMessage) SDL_DestroyTexture(currentMessage);
-    if (font) TTF_CloseFont(font);
-    if (radioTexture) SDL_DestroyTexture(radioTexture);
+    delete textRenderer;
+    AssetCache::release(radioTexture);
 
 }
 
@@ -63,8 +61,7 @@ void Messages::start() {
     startTime = SDL_GetTicks();
     state = SLIDE_IN;
 
-    if (currentMessage) SDL_DestroyTexture(currentMessage);
-    currentMessage = createTexture(messageList[currentIndex]);
+    currentMessage = messageList[currentIndex];
 }
 
 void Messages::startTypewriter(const std::string& text) {
@@ -78,23 +75,12 @@ void Messages::startTypewriter(const std::string& text) {
 
     // measure text
     int w, h;
-    if (TTF_SizeText(font, text.c_str(), &w, &h) == 0) {
-        radioW = w + 40;
-        radioH = h + 30;
-    }
+    textRenderer->measure(text, &w, &h);
+    radioW = w + 40;
+    radioH = h + 30;
 }
 
 
-SDL_Texture* Messages::createTexture(const std::string& text) {
-    SDL_Color white = {255, 255, 255};
-    SDL_Surface* surf = TTF_RenderText_Blended_Wrapped(font, text.c_str(), white, 480);
-    if (!surf) return nullptr;
-
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-    SDL_FreeSurface(surf);
-    return tex;
-}
-
 void Messages::update() 
 {
     Uint32 now = SDL_GetTicks();
@@ -201,8 +187,7 @@ void Messages::update()
                 return;
             }
 
-            if (currentMessage) SDL_DestroyTexture(currentMessage);
-            currentMessage = createTexture(messageList[currentIndex]);
+            currentMessage = messageList[currentIndex];
             startTime = now;
             x = -400;
             alpha = 0;
@@ -213,9 +198,6 @@ void Messages::update()
     default:
         break;
     }
-
-    if (currentMessage)
-        SDL_SetTextureAlphaMod(currentMessage, Uint8(alpha));
 }
 
 
@@ -228,35 +210,25 @@ void Messages::render() {
         // RADIO SPRITE
     if (radioTexture) {
         SDL_Rect radioRect = { 10, yPos - 12, 70, 70 }; // adjust to size you want
-        SDL_RenderCopy(renderer, radioTexture, NULL, &radioRect);
+        RenderStats::copy(renderer, radioTexture, NULL, &radioRect);
     }
 
         SDL_Rect box = { xPos, yPos, radioW, radioH };
-        SDL_SetRenderDrawColor(renderer, 10, 10, 40, 220);
-        SDL_RenderFillRect(renderer, &box);
-
-        SDL_SetRenderDrawColor(renderer, 80, 160, 255, 255);
-        SDL_RenderDrawRect(renderer, &box);
-
-        SDL_Color white = {255,255,255};
-        SDL_Surface* surf =
-            TTF_RenderText_Blended_Wrapped(font, visibleText.c_str(), white, radioW - 20);
+        RenderStats::setDrawColor(renderer, 10, 10, 40, 220);
+        RenderStats::fillRect(renderer, &box);
 
-        if (surf) {
-            SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-            SDL_Rect txt = { xPos + 10, yPos + 15, surf->w, surf->h };
-            SDL_RenderCopy(renderer, tex, NULL, &txt);
+        RenderStats::setDrawColor(renderer, 80, 160, 255, 255);
+        RenderStats::drawRect(renderer, &box);
 
-            SDL_FreeSurface(surf);
-            SDL_DestroyTexture(tex);
-        }
+        SDL_Color white = {255, 255, 255, 255};
+        textRenderer->drawWrapped(visibleText, xPos + 10, yPos + 15, white, radioW - 20);
         return;
     }
 
     // CUTSCENE
-    if (currentMessage) {
-        SDL_Rect rect = { int(x), 450, 380, 110 };
-        SDL_RenderCopy(renderer, currentMessage, NULL, &rect);
+    if (!currentMessage.empty()) {
+        SDL_Color faded = {255, 255, 255, Uint8(alpha)};
+        textRenderer->drawWrapped(currentMessage, int(x), 450, faded, popupWidth);
     }
 }
 
@@ -276,10 +248,7 @@ void Messages::clear() {
     x = -400;
     alpha = 0;
 
-    if (currentMessage) {
-        SDL_DestroyTexture(currentMessage);
-        currentMessage = nullptr;
-    }
+    currentMessage.clear();
 }
 
 
@@ -0,0 +1,124 @@
+#include "PerfHud.h"
+#include "FontManager.h"
+#include "RenderStats.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+const int PANEL_X = 5;
+const int PANEL_Y = 50;          // Below the hearts
+const int PANEL_W = 300;
+const int GRAPH_H = 60;
+const float GRAPH_MAX_MS = 33.3f; // Top of the graph (30 fps)
+const float BUDGET_MS = 1000.0f / 60.0f;
+}
+
+PerfHud::PerfHud(SDL_Renderer* renderer)
+    : renderer(renderer), text(new TextRenderer(renderer, FontManager::get(UI_FONT_PATH, 14))),
+      visible(false), frameTimes(HISTORY, 0.0f), nextSample(0), sampleCount(0),
+      lastSimMs(0.0), lastRenderMs(0.0)
+{
+}
+
+PerfHud::~PerfHud() {
+    delete text;
+}
+
+void PerfHud::recordFrame(double frameMs, double simMs, double renderMs) {
+    frameTimes[nextSample] = float(frameMs);
+    nextSample = (nextSample + 1) % HISTORY;
+    if (sampleCount < HISTORY) sampleCount++;
+    lastSimMs = simMs;
+    lastRenderMs = renderMs;
+}
+
+double PerfHud::frameTimePercentile(double p) const {
+    if (sampleCount == 0) return 0.0;
+    sorted.assign(frameTimes.begin(), frameTimes.begin() + sampleCount);
+    std::sort(sorted.begin(), sorted.end());
+
+    // Nearest rank
+    int rank = int(std::ceil(p * sampleCount / 100.0));
+    if (rank < 1) rank = 1;
+    if (rank > sampleCount) rank = sampleCount;
+    return sorted[rank - 1];
+}
+
+void PerfHud::render(const Level& level) {
+    if (!visible) return;
+
+    int lineHeight = text->isLoaded() ? text->getLineHeight() : 16;
+    const int textLines = 6;
+    int panelH = 10 + textLines * lineHeight + 10 + GRAPH_H + 10;
+
+    RenderStats::setBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    RenderStats::setDrawColor(renderer, 0, 0, 0, 170);
+    SDL_Rect panel = { PANEL_X, PANEL_Y, PANEL_W, panelH };
+    RenderStats::fillRect(renderer, &panel);
+
+    // Text block
+    double p50 = frameTimePercentile(50);
+    double p99 = frameTimePercentile(99);
+    double fps = p50 > 0.0 ? 1000.0 / p50 : 0.0;
+
+    int litter = int(level.getLitterItems().size()) + level.getLitterFlow().size();
+    int enemies = int(level.getEnemyItems().size());
+    int oilSpots = int(level.getOilSpots().size());
+
+    const RenderStats::Frame& calls = RenderStats::lastFrame();
+    char label[512];
+    snprintf(label, sizeof(label),
+             "FPS %.0f   p50 %.1f ms   p99 %.1f ms\n"
+             "Sim %.2f ms   Render %.2f ms\n"
+             "Draw calls %d (copy %d, fill %d, line %d, geo %d)\n"
+             "Litter %d   Animals %d   Oil spots %d\n"
+             "Textures %d, %.1f MB\n"
+             "F3 to hide",
+             fps, p50, p99,
+             lastSimMs, lastRenderMs,
+             calls.total(), calls.copies, calls.fills, calls.outlines, calls.geometry,
+             litter, enemies, oilSpots,
+             RenderStats::getTextureCount(), RenderStats::getTextureBytes() / (1024.0 * 1024.0));
+    SDL_Color white = { 255, 255, 255, 255 };
+    text->drawWrapped(label, PANEL_X + 8, PANEL_Y + 8, white, PANEL_W - 16);
+
+    // Frame-time graph, oldest on the left, as one mesh
+    int graphX = PANEL_X + 10;
+    int graphBottom = PANEL_Y + panelH - 10;
+    float barW = float(PANEL_W - 20) / HISTORY;
+    graphVertices.clear();
+    graphIndices.clear();
+
+    auto addQuad = [this](float x0, float y0, float x1, float y1, SDL_Color c) {
+        int base = int(graphVertices.size());
+        graphVertices.push_back({ { x0, y0 }, c, { 0, 0 } });
+        graphVertices.push_back({ { x1, y0 }, c, { 0, 0 } });
+        graphVertices.push_back({ { x1, y1 }, c, { 0, 0 } });
+        graphVertices.push_back({ { x0, y1 }, c, { 0, 0 } });
+        int quad[6] = { base, base + 1, base + 2, base, base + 2, base + 3 };
+        graphIndices.insert(graphIndices.end(), quad, quad + 6);
+    };
+
+    for (int i = 0; i < sampleCount; i++) {
+        int sample = (nextSample - sampleCount + i + HISTORY) % HISTORY;
+        float ms = frameTimes[sample];
+        float h = std::min(ms, GRAPH_MAX_MS) / GRAPH_MAX_MS * GRAPH_H;
+
+        // Green within budget, yellow up to 30 fps, red beyond
+        SDL_Color c = { 80, 220, 80, 255 };
+        if (ms > BUDGET_MS + 1.0f) c = { 240, 200, 60, 255 };
+        if (ms > GRAPH_MAX_MS) c = { 240, 70, 70, 255 };
+
+        float x = graphX + (HISTORY - sampleCount + i) * barW;
+        addQuad(x, graphBottom - h, x + barW, float(graphBottom), c);
+    }
+
+    // 60 fps budget line
+    float budgetY = graphBottom - BUDGET_MS / GRAPH_MAX_MS * GRAPH_H;
+    addQuad(float(graphX), budgetY, float(graphX + PANEL_W - 20), budgetY + 1.0f, SDL_Color{ 255, 255, 255, 140 });
+
+    RenderStats::geometry(renderer, nullptr,
+                          graphVertices.data(), int(graphVertices.size()),
+                          graphIndices.data(), int(graphIndices.size()));
+}
@@ -0,0 +1,151 @@
+#include "Profiler.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct ZoneRecord {
+    const char* name;
+    int64_t startNs;
+    int64_t durationNs;
+};
+
+// One per thread. The lock is only ever contended while a trace is being
+// written, so recording a zone stays cheap.
+struct ThreadBuffer {
+    std::mutex lock;
+    std::vector<ZoneRecord> ring;
+    uint64_t written = 0;       // Total zones recorded (ring index = written % size)
+    const char* threadName = nullptr;
+    int threadId = 0;
+};
+
+struct Registry {
+    std::mutex lock;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;   // Outlive their threads
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+ThreadBuffer& threadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        buffer->ring.resize(Profiler::RING_SIZE);
+
+        Registry& r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        buffer->threadId = int(r.buffers.size()) + 1;
+        r.buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void writeJsonString(FILE* out, const char* s) {
+    fputc('"', out);
+    for (; s && *s; s++) {
+        if (*s == '"' || *s == '\\') fputc('\\', out);
+        if ((unsigned char)*s >= 0x20) fputc(*s, out);
+    }
+    fputc('"', out);
+}
+
+}  // namespace
+
+int64_t Profiler::nowNs() {
+    auto elapsed = std::chrono::steady_clock::now() - registry().start;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+Profiler::Zone::Zone(const char* name)
+    : name(name), startNs(nowNs())
+{
+}
+
+Profiler::Zone::~Zone() {
+    int64_t endNs = nowNs();
+    ThreadBuffer& b = threadBuffer();
+    std::lock_guard<std::mutex> guard(b.lock);
+    b.ring[b.written % RING_SIZE] = { name, startNs, endNs - startNs };
+    b.written++;
+}
+
+void Profiler::setThreadName(const char* name) {
+    ThreadBuffer& b = threadBuffer();
+    std::lock_guard<std::mutex> guard(b.lock);
+    b.threadName = name;
+}
+
+void Profiler::clear() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    for (auto& b : r.buffers) {
+        std::lock_guard<std::mutex> bufferGuard(b->lock);
+        b->written = 0;
+    }
+}
+
+int Profiler::threadZoneCount() {
+    ThreadBuffer& b = threadBuffer();
+    std::lock_guard<std::mutex> guard(b.lock);
+    return b.written < (uint64_t)RING_SIZE ? int(b.written) : RING_SIZE;
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) {
+    FILE* out = fopen(path.c_str(), "w");
+    if (!out) return false;
+
+    // Snapshot the buffer list, then copy each ring under its own lock so
+    // the other threads are only held up for a memcpy
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        buffers = r.buffers;
+    }
+
+    fprintf(out, "{\"traceEvents\":[\n");
+    bool first = true;
+    std::vector<ZoneRecord> zones;
+    for (auto& b : buffers) {
+        const char* threadName;
+        {
+            std::lock_guard<std::mutex> guard(b->lock);
+            threadName = b->threadName;
+            uint64_t count = b->written < (uint64_t)RING_SIZE ? b->written : RING_SIZE;
+            zones.clear();
+            for (uint64_t i = b->written - count; i < b->written; i++) {
+                zones.push_back(b->ring[i % RING_SIZE]);
+            }
+        }
+
+        if (threadName) {
+            fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":",
+                    first ? "" : ",\n", b->threadId);
+            writeJsonString(out, threadName);
+            fprintf(out, "}}");
+            first = false;
+        }
+
+        // Complete ("X") events, timestamps in microseconds
+        for (const ZoneRecord& z : zones) {
+            fprintf(out, "%s{\"name\":", first ? "" : ",\n");
+            writeJsonString(out, z.name);
+            fprintf(out, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    b->threadId, z.startNs / 1000.0, z.durationNs / 1000.0);
+            first = false;
+        }
+    }
+    fprintf(out, "\n]}\n");
+
+    bool ok = !ferror(out);
+    fclose(out);
+    return ok;
+}
@@ -0,0 +1,99 @@
+#include "RenderList.h"
+
+void RenderList::reset() {
+    commands.clear();
+    vertices.clear();
+    indices.clear();
+}
+
+RenderList::Command& RenderList::add(Type type) {
+    Command c = {};
+    c.type = type;
+    commands.push_back(c);
+    return commands.back();
+}
+
+void RenderList::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    add(Type::DrawColor).color = SDL_Color{ r, g, b, a };
+}
+
+void RenderList::setBlendMode(SDL_BlendMode mode) {
+    add(Type::BlendMode).blendMode = mode;
+}
+
+void RenderList::clear() {
+    add(Type::Clear);
+}
+
+void RenderList::copy(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dest) {
+    Command& c = add(Type::Copy);
+    c.texture = texture;
+    if (src) { c.src = *src; c.hasSrc = true; }
+    if (dest) { c.dest = *dest; c.hasDest = true; }
+}
+
+void RenderList::fillRect(const SDL_Rect* rect) {
+    Command& c = add(Type::FillRect);
+    if (rect) { c.dest = *rect; c.hasDest = true; }
+}
+
+void RenderList::drawRect(const SDL_Rect* rect) {
+    Command& c = add(Type::DrawRect);
+    if (rect) { c.dest = *rect; c.hasDest = true; }
+}
+
+void RenderList::drawLine(int x1, int y1, int x2, int y2) {
+    Command& c = add(Type::DrawLine);
+    c.src.x = x1;
+    c.src.y = y1;
+    c.dest.x = x2;
+    c.dest.y = y2;
+}
+
+void RenderList::geometry(SDL_Texture* texture, const SDL_Vertex* vertices_, int numVertices,
+                          const int* indices_, int numIndices) {
+    Command& c = add(Type::Geometry);
+    c.texture = texture;
+    c.firstVertex = int(vertices.size());
+    c.vertexCount = numVertices;
+    c.firstIndex = int(indices.size());
+    c.indexCount = indices_ ? numIndices : 0;
+    vertices.insert(vertices.end(), vertices_, vertices_ + numVertices);
+    if (indices_) indices.insert(indices.end(), indices_, indices_ + numIndices);
+}
+
+void RenderList::replay(SDL_Renderer* renderer) const {
+    for (const Command& c : commands) {
+        const SDL_Rect* src = c.hasSrc ? &c.src : nullptr;
+        const SDL_Rect* dest = c.hasDest ? &c.dest : nullptr;
+
+        switch (c.type) {
+            case Type::DrawColor:
+                SDL_SetRenderDrawColor(renderer, c.color.r, c.color.g, c.color.b, c.color.a);
+                break;
+            case Type::BlendMode:
+                SDL_SetRenderDrawBlendMode(renderer, c.blendMode);
+                break;
+            case Type::Clear:
+                SDL_RenderClear(renderer);
+                break;
+            case Type::Copy:
+                SDL_RenderCopy(renderer, c.texture, src, dest);
+                break;
+            case Type::FillRect:
+                SDL_RenderFillRect(renderer, dest);
+                break;
+            case Type::DrawRect:
+                SDL_RenderDrawRect(renderer, dest);
+                break;
+            case Type::DrawLine:
+                SDL_RenderDrawLine(renderer, c.src.x, c.src.y, c.dest.x, c.dest.y);
+                break;
+            case Type::Geometry:
+                SDL_RenderGeometry(renderer, c.texture,
+                                   vertices.data() + c.firstVertex, c.vertexCount,
+                                   c.indexCount ? indices.data() + c.firstIndex : nullptr, c.indexCount);
+                break;
+        }
+    }
+}
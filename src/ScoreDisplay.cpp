@@ -1,54 +1,43 @@
 #include "ScoreDisplay.hpp"
+#include "Simulation.h"
+#include "FontManager.h"
+#include "RenderStats.h"
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include <string>
 
 ScoreDisplay::ScoreDisplay(SDL_Renderer* renderer, int x, int y, int width, int height) 
-    : renderer(renderer), score(0), level(1), scoreTexture(nullptr), levelTexture(nullptr) {
+    : renderer(renderer), score(0), level(1), font(nullptr), textRenderer(nullptr) {
     scoreRect.x = x;
     scoreRect.y = y;
     scoreRect.w = width;
     scoreRect.h = height;
 
-    // Initialize SDL_ttf
-    if (TTF_Init() < 0) {
-        SDL_Log("SDL_ttf could not initialize! SDL_ttf Error: %s\n", TTF_GetError());
-        return;
-    }
-
-    // Load font
-    font = TTF_OpenFont("assets/fonts/OpenSans.ttf", 24);
+    // Load font (shared, FontManager also handles TTF_Init)
+    font = FontManager::get(UI_FONT_PATH, 24);
     if (!font) {
-        SDL_Log("Failed to load font! SDL_ttf Error: %s\n", TTF_GetError());
         return;
     }
 
-    // Initialize both textures
-    updateTextTexture();
-    updateLevelTexture();
+    textRenderer = new TextRenderer(renderer, font);
+
+    // Initialize both strings
+    updateScoreText();
+    updateLevelText();
 }
 
 ScoreDisplay::~ScoreDisplay() {
-    if (scoreTexture) {
-        SDL_DestroyTexture(scoreTexture);
-    }
-    if (levelTexture) {
-        SDL_DestroyTexture(levelTexture);
-    }
-    if (font) {
-        TTF_CloseFont(font);
-    }
-    TTF_Quit();
+    delete textRenderer;
 }
 
 void ScoreDisplay::render() {
     // Render the background rectangle
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200); // Semi-transparent black
-    SDL_RenderFillRect(renderer, &scoreRect);
+    RenderStats::setDrawColor(renderer, 0, 0, 0, 200); // Semi-transparent black
+    RenderStats::fillRect(renderer, &scoreRect);
     
     // Render the border
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White border
-    SDL_RenderDrawRect(renderer, &scoreRect);
+    RenderStats::setDrawColor(renderer, 255, 255, 255, 255); // White border
+    RenderStats::drawRect(renderer, &scoreRect);
 
     // Render the score and level text
     renderScore();
@@ -59,19 +48,12 @@ void ScoreDisplay::setScore(int newScore) {
     if (score != newScore) {
         score = newScore;
         // Update level if score reaches thresholds
-        if (score >= 400 && level == 3) {
-            level = 4;  // Level 4 starts 500 points after Level 3 (200 + 500 = 700)
-            updateLevelTexture();
-        }
-        else if (score >= 200 && level == 2) {
-            level = 3;
-            updateLevelTexture();
+        int newLevel = Simulation::levelForScore(score, level);
+        if (newLevel != level) {
+            level = newLevel;
+            updateLevelText();
         }
-        else if (score >= 100 && level == 1) {
-            level = 2;
-            updateLevelTexture();
-        }
-        updateTextTexture();
+        updateScoreText();
     }
 }
 
@@ -79,88 +61,46 @@ int ScoreDisplay::getScore() const {
     return score;
 }
 
-void ScoreDisplay::updateTextTexture() {
-    if (scoreTexture) {
-        SDL_DestroyTexture(scoreTexture);
-        scoreTexture = nullptr;
-    }
-
-    if (!font) {
-        return;
-    }
-
-    // Create text surface
-    SDL_Color textColor = {255, 255, 255, 255}; // White text
-    std::string scoreText = "Score: " + std::to_string(score);
-    SDL_Surface* textSurface = TTF_RenderText_Solid(font, scoreText.c_str(), textColor);
-    
-    if (textSurface) {
-        scoreTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-        SDL_FreeSurface(textSurface);
-    }
+void ScoreDisplay::updateScoreText() {
+    scoreText = "Score: " + std::to_string(score);
 }
 
-void ScoreDisplay::updateLevelTexture() {
-    if (levelTexture) {
-        SDL_DestroyTexture(levelTexture);
-        levelTexture = nullptr;
-    }
-
-    if (!font) {
-        return;
-    }
-
-    // Create text surface
-    SDL_Color textColor = {255, 255, 255, 255}; // White text
-    std::string levelText = "Level: " + std::to_string(level);
-    SDL_Surface* textSurface = TTF_RenderText_Solid(font, levelText.c_str(), textColor);
-    
-    if (textSurface) {
-        levelTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-        SDL_FreeSurface(textSurface);
-    }
+void ScoreDisplay::updateLevelText() {
+    levelText = "Level: " + std::to_string(level);
 }
 
 void ScoreDisplay::renderScore() {
-    if (!scoreTexture) {
+    if (!textRenderer || !textRenderer->isLoaded()) {
         return;
     }
 
-    // Get the dimensions of the text texture
+    // Get the dimensions of the text
     int textWidth, textHeight;
-    SDL_QueryTexture(scoreTexture, NULL, NULL, &textWidth, &textHeight);
+    textRenderer->measure(scoreText, &textWidth, &textHeight);
 
     // Position the score text in the upper part of the rectangle
-    SDL_Rect textRect = {
+    SDL_Color textColor = {255, 255, 255, 255}; // White text
+    textRenderer->draw(scoreText,
         scoreRect.x + (scoreRect.w - textWidth) / 2,
         scoreRect.y + 10, // Increased padding from top
-        textWidth,
-        textHeight
-    };
-
-    // Render the score text
-    SDL_RenderCopy(renderer, scoreTexture, NULL, &textRect);
+        textColor);
 }
 
 void ScoreDisplay::renderLevel() {
-    if (!levelTexture) {
+    if (!textRenderer || !textRenderer->isLoaded()) {
         return;
     }
 
-    // Get the dimensions of the level texture
+    // Get the dimensions of the level text
     int textWidth, textHeight;
-    SDL_QueryTexture(levelTexture, NULL, NULL, &textWidth, &textHeight);
+    textRenderer->measure(levelText, &textWidth, &textHeight);
 
     // Position the level text below the score
-    SDL_Rect textRect = {
+    SDL_Color textColor = {255, 255, 255, 255}; // White text
+    textRenderer->draw(levelText,
         scoreRect.x + (scoreRect.w - textWidth) / 2,
         scoreRect.y + 45, // Fixed position for level text, below score
-        textWidth,
-        textHeight
-    };
-
-    // Render the level text
-    SDL_RenderCopy(renderer, levelTexture, NULL, &textRect);
+        textColor);
 }
 
 int ScoreDisplay::getLevel() const {
@@ -169,5 +109,5 @@ int ScoreDisplay::getLevel() const {
 
 void ScoreDisplay::resetLevel() {
     level = 1;
-    updateLevelTexture();
+    updateLevelText();
 }
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include "Simulation.h"
+#include "Profiler.h"
+
+Simulation::Simulation(const SimConfig& config_, uint64_t seed_)
+    : config(config_),
+      seed(seed_),
+      levelSeeds(seed_),
+      submarine(SPRITE_SUBMARINE, 200, 275, config_.submarineWidth, config_.submarineHeight),
+      // The seeds given here are replaced when each level starts
+      level1(config),
+      level2(config),
+      level3(config),
+      level4(config),
+      levels{ &level1, &level2, &level3, &level4 },
+      active(&level1),
+      level(&level1),
+      jobPool(nullptr),
+      jobGrain(Level::DEFAULT_JOB_GRAIN),
+      score(0),
+      lives(3),
+      currentLevel(1),
+      gameOver(false),
+      victory(false),
+      showingLevel4Intro(false),
+      level4IntroTimer(0),
+      stormWarningSent(false)
+{
+    for (Level* l : levels) l->setWorld(&world);
+    startLevel(1, false);
+}
+
+void Simulation::reset() {
+    startLevel(1, false);
+
+    submarine.setPosition(200, 275);
+    submarine.reset();
+
+    score = 0;
+    lives = 3;
+    currentLevel = 1;
+    gameOver = false;
+    victory = false;
+    showingLevel4Intro = false;
+    level4IntroTimer = 0;
+    stormWarningSent = false;
+    events.clear();
+}
+
+void Simulation::reset(uint64_t seed_) {
+    seed = seed_;
+    levelSeeds.reseed(seed_);
+    reset();
+}
+
+void Simulation::setJobPool(JobPool* pool, int grain) {
+    jobPool = pool;
+    jobGrain = grain;
+    for (Level* l : levels) l->setJobPool(pool, grain);
+}
+
+void Simulation::startLevel(int number, bool keepWorld) {
+    if (number < 1) number = 1;
+    if (number > LEVEL_COUNT) number = LEVEL_COUNT;
+    switch (number) {
+        case 1: active = &level1; break;
+        case 2: active = &level2; break;
+        case 3: active = &level3; break;
+        default: active = &level4; break;
+    }
+    level = levels[number - 1];
+    if (keepWorld) level->enter(levelSeeds.next64());
+    else level->reset(levelSeeds.next64());
+}
+
+int Simulation::scoreToLeaveLevel(int level) {
+    switch (level) {
+        case 1: return 100;
+        case 2: return 200;
+        case 3: return 400;
+        default: return -1;  // Level 4 ends on its timer
+    }
+}
+
+int Simulation::levelForScore(int score, int level) {
+    int threshold = scoreToLeaveLevel(level);
+    if (threshold >= 0 && score >= threshold) {
+        return level + 1;
+    }
+    return level;
+}
+
+void Simulation::step(const SimInput& input) {
+    PROFILE_ZONE("Simulation::step");
+    events.clear();
+    if (gameOver) return;
+
+    // From here on the level's type is known, so its update is a plain call
+    std::visit([this, &input](auto* current) { stepLevel(*current, input); }, active);
+
+    // Swap in the next level once the score crosses its threshold
+    int newLevel = levelForScore(score, currentLevel);
+    if (newLevel != currentLevel) {
+        changeLevel(newLevel);
+    }
+
+    // Level 4 timer completed with lives left: victory
+    if (level->hasStorm() && lives > 0 && level->getStormTimer() <= 0) {
+        gameOver = true;
+        victory = true;
+    }
+}
+
+template <typename L>
+void Simulation::stepLevel(L& current, const SimInput& input) {
+    // Check if submarine is in blackout to slow movement (only for Level3)
+    SimRect subRect = submarine.getRect();
+    int subCenterX = subRect.x + subRect.w / 2;
+    int subCenterY = subRect.y + subRect.h / 2;
+    bool inBlackout = false;
+    if constexpr (L::HAS_BLACKOUT) {
+        inBlackout = current.isPositionInBlackout(subCenterX, subCenterY);
+    }
+    int moveSpeed = inBlackout ? 2 : 5; // Slow movement in blackout
+
+    if (input.up)    submarine.moveBy(0, -moveSpeed);
+    if (input.down)  submarine.moveBy(0, moveSpeed);
+    if (input.left)  submarine.moveBy(-moveSpeed, 0);
+    if (input.right) submarine.moveBy(moveSpeed, 0);
+
+    // Calm ability
+    if (input.calm) {
+        float subX = subRect.x + subRect.w / 2.0f;
+        float subY = subRect.y + subRect.h / 2.0f;
+        current.calmEnemies(subX, subY, 150.0f);  // 150 pixel radius
+    }
+
+    submarine.clamp(50, 650, 0, 540);
+
+    // Update submarine blink effect
+    submarine.updateBlink();
+
+    // Level 4 intro sequence - pause gameplay
+    if (showingLevel4Intro) {
+        level4IntroTimer++;
+
+        // End intro after 3 seconds
+        if (level4IntroTimer >= 180) {
+            showingLevel4Intro = false;
+            stormWarningSent = false;
+        }
+    } else {
+        // Normal gameplay - update level
+        {
+            PROFILE_ZONE("Level::update");
+            current.update(submarine, events);
+        }
+        applyEvents();
+
+        // Level 4 timer is about to run out
+        if constexpr (L::HAS_STORM) {
+            if (!stormWarningSent && current.getStormTimer() <= 660) {
+                events.push_back({ SimEventType::StormWarning });
+                stormWarningSent = true;
+            }
+        }
+    }
+}
+
+void Simulation::applyEvents() {
+    for (const SimEvent& e : events) {
+        switch (e.type) {
+        case SimEventType::LitterCollected:
+            score += e.value;
+            break;
+        case SimEventType::LitterMissed:
+            score -= e.value;
+            break;
+        case SimEventType::EnemyHit:
+            lives -= e.value;
+            if (lives <= 0) gameOver = true;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void Simulation::changeLevel(int newLevel) {
+    currentLevel = newLevel;
+
+    if (currentLevel >= 4) {
+        // Final level starts with its own litter flow and no animals
+        startLevel(currentLevel, false);
+
+        // Start Level 4 intro sequence
+        showingLevel4Intro = true;
+        level4IntroTimer = 0;
+    } else {
+        // Litter and animals stay where they are; only the rules change
+        startLevel(currentLevel, true);
+    }
+
+    events.push_back({ SimEventType::LevelChanged, currentLevel });
+}
@@ -0,0 +1,150 @@
+#include "SpatialGrid.h"
+#include <cmath>
+
+SpatialGrid::SpatialGrid(int cellSize_, int minX, int minY, int maxX, int maxY)
+    : cellSize(cellSize_ > 0 ? cellSize_ : 64), originX(minX), originY(minY), queryStamp(0)
+{
+    cols = (maxX - minX + cellSize - 1) / cellSize;
+    rows = (maxY - minY + cellSize - 1) / cellSize;
+    if (cols < 1) cols = 1;
+    if (rows < 1) rows = 1;
+    cells.resize(cols * rows);
+    cellUsed.resize(cols * rows, 0);
+}
+
+void SpatialGrid::clear() {
+    for (int cell : usedCells) {
+        cells[cell].clear();
+        cellUsed[cell] = 0;
+    }
+    usedCells.clear();
+    for (Item& item : items) item.listed = false;
+}
+
+void SpatialGrid::cellRange(int x0, int y0, int x1, int y1, int& c0, int& r0, int& c1, int& r1) const {
+    // Floor division so negative coordinates land in the right cell
+    auto toCell = [this](int v, int origin, int count) {
+        int c = (int)std::floor((v - origin) / (float)cellSize);
+        if (c < 0) c = 0;
+        if (c >= count) c = count - 1;
+        return c;
+    };
+    c0 = toCell(x0, originX, cols);
+    c1 = toCell(x1, originX, cols);
+    r0 = toCell(y0, originY, rows);
+    r1 = toCell(y1, originY, rows);
+}
+
+void SpatialGrid::insert(int id, const SimRect& rect) {
+    insert(id, rect, rect.x + rect.w / 2.0f, rect.y + rect.h / 2.0f);
+}
+
+void SpatialGrid::insert(int id, const SimRect& rect, float centerX, float centerY) {
+    if (id < 0) return;
+    if (id >= (int)items.size()) {
+        items.resize(id + 1, Item{ {}, 0.0f, 0.0f, 0, 0, 0, 0, false });
+        seenStamp.resize(id + 1, 0);
+    }
+
+    // Every cell the rect (and its center) touches
+    int x0 = rect.x, y0 = rect.y, x1 = rect.x + rect.w, y1 = rect.y + rect.h;
+    if (centerX < x0) x0 = (int)std::floor(centerX);
+    if (centerY < y0) y0 = (int)std::floor(centerY);
+    if (centerX > x1) x1 = (int)std::ceil(centerX);
+    if (centerY > y1) y1 = (int)std::ceil(centerY);
+
+    int c0, r0, c1, r1;
+    cellRange(x0, y0, x1, y1, c0, r0, c1, r1);
+
+    Item& item = items[id];
+    if (item.listed) {
+        // Still in the same cells: only the stored position changes
+        if (item.c0 == c0 && item.r0 == r0 && item.c1 == c1 && item.r1 == r1) {
+            item.rect = rect;
+            item.cx = centerX;
+            item.cy = centerY;
+            return;
+        }
+        unlist(id);
+    }
+    item = { rect, centerX, centerY, c0, r0, c1, r1, true };
+
+    for (int r = r0; r <= r1; r++) {
+        for (int c = c0; c <= c1; c++) {
+            int cell = r * cols + c;
+            if (!cellUsed[cell]) {
+                cellUsed[cell] = 1;
+                usedCells.push_back(cell);
+            }
+            cells[cell].push_back(id);
+        }
+    }
+}
+
+void SpatialGrid::remove(int id) {
+    if (id < 0 || id >= (int)items.size() || !items[id].listed) return;
+    unlist(id);
+    items[id].listed = false;
+}
+
+void SpatialGrid::unlist(int id) {
+    const Item& item = items[id];
+    for (int r = item.r0; r <= item.r1; r++) {
+        for (int c = item.c0; c <= item.c1; c++) {
+            // Cells hold a handful of ids, and their order doesn't matter
+            std::vector<int>& cell = cells[r * cols + c];
+            for (size_t i = 0; i < cell.size(); i++) {
+                if (cell[i] == id) {
+                    cell[i] = cell.back();
+                    cell.pop_back();
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void SpatialGrid::queryRect(const SimRect& area, std::vector<int>& out) const {
+    out.clear();
+    if (++queryStamp == 0) {
+        // Wrapped around: start the stamps over
+        for (unsigned& s : seenStamp) s = 0;
+        queryStamp = 1;
+    }
+
+    int c0, r0, c1, r1;
+    cellRange(area.x, area.y, area.x + area.w, area.y + area.h, c0, r0, c1, r1);
+    for (int r = r0; r <= r1; r++) {
+        for (int c = c0; c <= c1; c++) {
+            for (int id : cells[r * cols + c]) {
+                if (seenStamp[id] == queryStamp) continue;
+                seenStamp[id] = queryStamp;
+                if (rectsOverlap(area, items[id].rect)) out.push_back(id);
+            }
+        }
+    }
+}
+
+void SpatialGrid::queryRadius(float cx, float cy, float radius, std::vector<int>& out) const {
+    out.clear();
+    if (++queryStamp == 0) {
+        for (unsigned& s : seenStamp) s = 0;
+        queryStamp = 1;
+    }
+
+    const float r2 = radius * radius;
+    int c0, r0, c1, r1;
+    cellRange((int)std::floor(cx - radius), (int)std::floor(cy - radius),
+              (int)std::ceil(cx + radius), (int)std::ceil(cy + radius), c0, r0, c1, r1);
+    for (int r = r0; r <= r1; r++) {
+        for (int c = c0; c <= c1; c++) {
+            for (int id : cells[r * cols + c]) {
+                if (seenStamp[id] == queryStamp) continue;
+                seenStamp[id] = queryStamp;
+                float dx = items[id].cx - cx;
+                float dy = items[id].cy - cy;
+                if (dx * dx + dy * dy <= r2) out.push_back(id);
+            }
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#include "SpriteAtlas.h"
+#include "Profiler.h"
+#include "RenderStats.h"
+#include <algorithm>
+#include <iostream>
+
+// Mirror an RGBA32 surface left to right
+static SDL_Surface* flipCopy(SDL_Surface* src) {
+    SDL_Surface* dst = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!dst) return nullptr;
+
+    for (int y = 0; y < src->h; y++) {
+        const Uint32* in = (const Uint32*)((const Uint8*)src->pixels + y * src->pitch);
+        Uint32* out = (Uint32*)((Uint8*)dst->pixels + y * dst->pitch);
+        for (int x = 0; x < src->w; x++) {
+            out[x] = in[src->w - 1 - x];
+        }
+    }
+    return dst;
+}
+
+// Bake the hit-blink red into an RGBA32 copy (matches SDL_SetTextureColorMod(255, 100, 100))
+static SDL_Surface* tintCopy(SDL_Surface* src) {
+    SDL_Surface* dst = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!dst) return nullptr;
+
+    for (int y = 0; y < src->h; y++) {
+        const Uint8* in = (const Uint8*)src->pixels + y * src->pitch;
+        Uint8* out = (Uint8*)dst->pixels + y * dst->pitch;
+        for (int x = 0; x < src->w; x++) {
+            out[x * 4 + 0] = in[x * 4 + 0];                   // R
+            out[x * 4 + 1] = Uint8(in[x * 4 + 1] * 100 / 255); // G
+            out[x * 4 + 2] = Uint8(in[x * 4 + 2] * 100 / 255); // B
+            out[x * 4 + 3] = in[x * 4 + 3];                   // A
+        }
+    }
+    return dst;
+}
+
+SpriteAtlas::SpriteAtlas(SDL_Renderer* renderer)
+    : renderer(renderer), texture(nullptr)
+{
+}
+
+SpriteAtlas::~SpriteAtlas() {
+    for (Pending& p : pending) SDL_FreeSurface(p.surface);
+    if (texture) RenderStats::destroyTexture(texture);
+}
+
+void SpriteAtlas::add(int sprite, SDL_Surface* image, int w, int h, bool withVariants) {
+    if (!image || sprite < 0 || w <= 0 || h <= 0) return;
+    if (w > ATLAS_WIDTH) {
+        std::cerr << "SpriteAtlas: sprite " << sprite << " is wider than the atlas" << std::endl;
+        return;
+    }
+
+    // Scale into a fresh RGBA32 surface so every copy has the same layout
+    SDL_Surface* scaled = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!scaled) {
+        std::cerr << "SpriteAtlas: failed to create surface: " << SDL_GetError() << std::endl;
+        return;
+    }
+    SDL_FillRect(scaled, nullptr, 0);
+    SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_NONE);  // Copy the alpha, don't blend it
+    SDL_BlitScaled(image, nullptr, scaled, nullptr);
+    SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_BLEND);
+
+    if (sprite >= (int)entries.size()) {
+        entries.resize(sprite + 1, Entry{ false, false, {} });
+    }
+    entries[sprite].present = true;
+    entries[sprite].hasVariants = withVariants;
+
+    pending.push_back({ sprite, NORMAL, scaled });
+    if (withVariants) {
+        SDL_Surface* flipped = flipCopy(scaled);
+        pending.push_back({ sprite, FLIPPED, flipped });
+        pending.push_back({ sprite, TINTED, tintCopy(scaled) });
+        pending.push_back({ sprite, FLIPPED_TINTED, flipped ? tintCopy(flipped) : nullptr });
+    }
+}
+
+bool SpriteAtlas::build() {
+    PROFILE_ZONE("SpriteAtlas::build");
+
+    // Tallest first packs the shelves tighter
+    std::stable_sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        int ha = a.surface ? a.surface->h : 0;
+        int hb = b.surface ? b.surface->h : 0;
+        return ha > hb;
+    });
+
+    int penX = 0, penY = 0, rowHeight = 0;
+    for (Pending& p : pending) {
+        if (!p.surface) continue;
+        if (penX + p.surface->w > ATLAS_WIDTH) {
+            penX = 0;
+            penY += rowHeight + 1;
+            rowHeight = 0;
+        }
+        entries[p.sprite].regions[p.variant] = { penX, penY, p.surface->w, p.surface->h };
+        penX += p.surface->w + 1;  // 1px gap so filtering doesn't bleed
+        if (p.surface->h > rowHeight) rowHeight = p.surface->h;
+    }
+    int atlasHeight = penY + rowHeight;
+
+    bool ok = false;
+    SDL_Surface* sheet = nullptr;
+    if (atlasHeight > 0) {
+        sheet = SDL_CreateRGBSurfaceWithFormat(0, ATLAS_WIDTH, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    }
+    if (sheet) {
+        SDL_FillRect(sheet, nullptr, 0);
+        for (Pending& p : pending) {
+            if (!p.surface) continue;
+            SDL_SetSurfaceBlendMode(p.surface, SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(p.surface, nullptr, sheet, &entries[p.sprite].regions[p.variant]);
+        }
+
+        if (texture) RenderStats::destroyTexture(texture);
+        texture = RenderStats::createTexture(renderer, sheet);
+        if (texture) {
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            ok = true;
+        } else {
+            std::cerr << "SpriteAtlas: failed to create texture: " << SDL_GetError() << std::endl;
+        }
+        SDL_FreeSurface(sheet);
+    }
+
+    for (Pending& p : pending) {
+        if (p.surface) SDL_FreeSurface(p.surface);
+    }
+    pending.clear();
+    return ok;
+}
+
+const SDL_Rect* SpriteAtlas::getRegion(int sprite, Variant variant) const {
+    if (sprite < 0 || sprite >= (int)entries.size() || !entries[sprite].present) return nullptr;
+
+    const Entry& e = entries[sprite];
+    return &e.regions[e.hasVariants ? variant : NORMAL];
+}
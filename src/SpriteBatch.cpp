@@ -0,0 +1,56 @@
+#include "SpriteBatch.h"
+#include "RenderStats.h"
+
+SpriteBatch::SpriteBatch(SDL_Renderer* renderer)
+    : renderer(renderer)
+{
+}
+
+SpriteBatch::Bucket& SpriteBatch::getBucket(SDL_Texture* texture) {
+    for (Bucket& b : buckets) {
+        if (b.texture == texture) return b;
+    }
+
+    Bucket b;
+    b.texture = texture;
+    int w = 1, h = 1;
+    SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
+    b.texW = float(w > 0 ? w : 1);
+    b.texH = float(h > 0 ? h : 1);
+    buckets.push_back(b);
+    return buckets.back();
+}
+
+void SpriteBatch::draw(SDL_Texture* texture, const SDL_Rect& src, const SDL_Rect& dest, SDL_Color color) {
+    if (!texture) return;
+    Bucket& b = getBucket(texture);
+
+    float x0 = float(dest.x), y0 = float(dest.y);
+    float x1 = float(dest.x + dest.w), y1 = float(dest.y + dest.h);
+    float u0 = src.x / b.texW, v0 = src.y / b.texH;
+    float u1 = (src.x + src.w) / b.texW, v1 = (src.y + src.h) / b.texH;
+
+    int base = int(b.vertices.size());
+    b.vertices.push_back({ { x0, y0 }, color, { u0, v0 } });
+    b.vertices.push_back({ { x1, y0 }, color, { u1, v0 } });
+    b.vertices.push_back({ { x1, y1 }, color, { u1, v1 } });
+    b.vertices.push_back({ { x0, y1 }, color, { u0, v1 } });
+
+    b.indices.push_back(base);
+    b.indices.push_back(base + 1);
+    b.indices.push_back(base + 2);
+    b.indices.push_back(base);
+    b.indices.push_back(base + 2);
+    b.indices.push_back(base + 3);
+}
+
+void SpriteBatch::flush() {
+    for (Bucket& b : buckets) {
+        if (b.vertices.empty()) continue;
+        RenderStats::geometry(renderer, b.texture,
+                           b.vertices.data(), int(b.vertices.size()),
+                           b.indices.data(), int(b.indices.size()));
+        b.vertices.clear();
+        b.indices.clear();
+    }
+}
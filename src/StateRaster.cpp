@@ -0,0 +1,110 @@
+#include "StateRaster.h"
+#include <algorithm>
+#include <cstring>
+
+StateRaster::StateRaster()
+    : cells(SIZE, 0)
+{
+}
+
+bool StateRaster::toCells(int x, int y, int w, int h, int& gx0, int& gy0, int& gx1, int& gy1) {
+    if (w <= 0 || h <= 0) return false;
+    // Floor division so things partly off the left/top edge clip right
+    auto floorDiv = [](int v) { return v >= 0 ? v / CELL : -((-v + CELL - 1) / CELL); };
+    gx0 = std::max(floorDiv(x), 0);
+    gy0 = std::max(floorDiv(y), 0);
+    gx1 = std::min(floorDiv(x + w - 1) + 1, WIDTH);
+    gy1 = std::min(floorDiv(y + h - 1) + 1, HEIGHT);
+    return gx0 < gx1 && gy0 < gy1;
+}
+
+void StateRaster::fillSpan(int channel, int gy, int gx0, int gx1, uint8_t value) {
+    gx0 = std::max(gx0, 0);
+    gx1 = std::min(gx1, WIDTH);
+    if (gy < 0 || gy >= HEIGHT || gx0 >= gx1) return;
+    std::memset(&cells[channel * PLANE_SIZE + gy * WIDTH + gx0], value, gx1 - gx0);
+}
+
+void StateRaster::fillRect(int channel, int x, int y, int w, int h, uint8_t value) {
+    int gx0, gy0, gx1, gy1;
+    if (!toCells(x, y, w, h, gx0, gy0, gx1, gy1)) return;
+    for (int gy = gy0; gy < gy1; gy++) {
+        std::memset(&cells[channel * PLANE_SIZE + gy * WIDTH + gx0], value, gx1 - gx0);
+    }
+}
+
+void StateRaster::maxRect(int channel, int x, int y, int w, int h, uint8_t value) {
+    int gx0, gy0, gx1, gy1;
+    if (!toCells(x, y, w, h, gx0, gy0, gx1, gy1)) return;
+    for (int gy = gy0; gy < gy1; gy++) {
+        // Plain loop over bytes; vectorizes to packed max
+        uint8_t* row = &cells[channel * PLANE_SIZE + gy * WIDTH];
+        for (int gx = gx0; gx < gx1; gx++) {
+            row[gx] = std::max(row[gx], value);
+        }
+    }
+}
+
+void StateRaster::rasterize(const Level& level, const Submarine& submarine) {
+    std::fill(cells.begin(), cells.end(), 0);
+
+    for (const Litter& l : level.getLitterItems()) {
+        if (l.active) fillRect(CH_LITTER, (int)l.x, (int)l.y, l.getWidth(), l.getHeight(), 255);
+    }
+    const EntityStore& flow = level.getLitterFlow();
+    for (int i = 0; i < flow.size(); i++) {
+        if (flow.flags[i] & EntityStore::FLAG_ACTIVE) {
+            fillRect(CH_LITTER, (int)flow.x[i], (int)flow.y[i], flow.width[i], flow.height[i], 255);
+        }
+    }
+
+    for (const Enemies& e : level.getEnemyItems()) {
+        if (!e.active || e.enemyType < 0 || e.enemyType >= ENEMY_TYPE_COUNT) continue;
+        fillRect(CH_SWORDFISH + e.enemyType, (int)e.x, (int)e.y, e.width, e.height, 255);
+    }
+
+    // Same rect the renderer draws the ink sprite in
+    for (const Level::OilSpot& spot : level.getOilSpots()) {
+        if (spot.alpha > 0.0f) {
+            maxRect(CH_INK, spot.x, spot.y, spot.size, spot.size, uint8_t(std::min(spot.alpha, 1.0f) * 255));
+        }
+    }
+
+    if (level.hasBlackout()) {
+        rasterizeBlackout(level);
+    }
+
+    SimRect sub = submarine.getRect();
+    fillRect(CH_SUBMARINE, sub.x, sub.y, sub.w, sub.h, 255);
+}
+
+void StateRaster::rasterizeBlackout(const Level& level) {
+    bool fading = level.isBlackoutFadingOut();
+    if (!level.isInBlackout() && !fading) return;
+
+    int width = level.getBlackoutWidth();
+    if (width >= 800 && !fading) {
+        std::memset(&cells[CH_BLACKOUT * PLANE_SIZE], 255, PLANE_SIZE);
+        return;
+    }
+
+    // Each row of cells takes the edge at its middle pixel row, with the
+    // same rule as Level::isPositionInBlackout (a cell counts when its
+    // center is covered)
+    const std::vector<int>& waves = level.getBlackoutWaves();
+    for (int gy = 0; gy < HEIGHT; gy++) {
+        int y = gy * CELL + CELL / 2;
+        int wave = y < (int)waves.size() ? waves[y] : 0;
+        if (fading) {
+            // Covered for x <= width + wave
+            int xEnd = width + wave;
+            int gx1 = xEnd < CELL / 2 ? 0 : (xEnd - CELL / 2) / CELL + 1;
+            fillSpan(CH_BLACKOUT, gy, 0, gx1, 255);
+        } else {
+            // Covered for x >= 800 - width + wave
+            int xStart = 800 - width + wave;
+            int gx0 = xStart <= CELL / 2 ? 0 : (xStart - CELL / 2 + CELL - 1) / CELL;
+            fillSpan(CH_BLACKOUT, gy, gx0, WIDTH, 255);
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #include "StoryManager.h"
 #include <SDL_ttf.h>
 #include <iostream>
+#include "FontManager.h"
+#include "RenderStats.h"
 
 StoryManager::StoryManager(Messages* msg)
     : messages(msg)
@@ -62,6 +64,11 @@ StoryManager::StoryManager(Messages* msg)
 
 }
 
+StoryManager::~StoryManager()
+{
+    delete bannerText;
+}
+
 void StoryManager::reset()
 {
     for (int i = 0; i < levels.size(); i++)
@@ -147,11 +154,9 @@ void StoryManager::update(int score, int level, int timeRemaining)
     // LEVEL 4 TIMER-BASED TRIGGERS
     if (level == 4)
     {
-        Level4* lv4 = dynamic_cast<Level4*>(currentLevelPtr);
-
-        if (lv4)
+        if (currentLevelPtr && currentLevelPtr->hasStorm())
         {
-            int timeLeftSec = lv4->getStormTimer() / 60;
+            int timeLeftSec = currentLevelPtr->getStormTimer() / 60;
 
             if (L.timeIndex < (int)L.timeTriggers.size() &&
                 timeLeftSec <= L.timeTriggers[L.timeIndex])
@@ -189,6 +194,11 @@ void StoryManager::update(int score, int level, int timeRemaining)
 }
 
 
+void StoryManager::loadFont(SDL_Renderer* renderer)
+{
+    if (!bannerText) bannerText = new TextRenderer(renderer, FontManager::get(UI_FONT_PATH, 22));
+}
+
 void StoryManager::renderLevelChange(SDL_Renderer* renderer)
 {
     if (!lvlChangeActive || lvlChangeText.empty()) return;
@@ -200,23 +210,17 @@ void StoryManager::renderLevelChange(SDL_Renderer* renderer)
         return;
     }
 
-    TTF_Font* font = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 22);
-    if (!font) return;
-
-    SDL_Color white = {255,255,255};
-    SDL_Surface* surf = TTF_RenderText_Blended(font, lvlChangeText.c_str(), white);
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
+    if (!bannerText || !bannerText->isLoaded()) return;
 
-    int w = surf->w;
-    int h = surf->h;
+    SDL_Color white = {255,255,255,255};
+    int w = 0, h = 0;
+    bannerText->measure(lvlChangeText, &w, &h);
 
     SDL_Rect bg = { 20, 460, w + 40, h + 20 };
 
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 170);
-    SDL_RenderFillRect(renderer, &bg);
-
-    SDL_Rect txt = { bg.x + 20, bg.y + 10, w, h };
+    RenderStats::setBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    RenderStats::setDrawColor(renderer, 0, 0, 0, 170);
+    RenderStats::fillRect(renderer, &bg);
 
     // TIMING
     Uint32 elapsed  = now - lvlChangeStart;
@@ -224,8 +228,7 @@ void StoryManager::renderLevelChange(SDL_Renderer* renderer)
     // FULLY VISIBLE FOR FIRST 3 SECONDS
     if (elapsed < 3000)  
     {
-        SDL_SetTextureAlphaMod(tex, 255);   // fully visible
-        SDL_RenderCopy(renderer, tex, NULL, &txt);
+        bannerText->draw(lvlChangeText, bg.x + 20, bg.y + 10, white);   // fully visible
     }
     else
     {
@@ -233,13 +236,7 @@ void StoryManager::renderLevelChange(SDL_Renderer* renderer)
         // Flickers every 60ms
         bool flickerOn = ((now / 60) % 2) == 0;
 
-        SDL_SetTextureAlphaMod(tex, flickerOn ? 255 : 0);
-
         if (flickerOn)
-            SDL_RenderCopy(renderer, tex, NULL, &txt);
+            bannerText->draw(lvlChangeText, bg.x + 20, bg.y + 10, white);
     }
-
-    SDL_FreeSurface(surf);
-    SDL_DestroyTexture(tex);
-    TTF_CloseFont(font);
 }
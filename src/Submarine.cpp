@@ -1,14 +1,11 @@
 #include "Submarine.h"
-#include <SDL.h>
 
-Submarine::Submarine(SDL_Texture* tex, int x, int y, int w, int h)
-    : texture(tex) {
+Submarine::Submarine(int sprite_, int x, int y, int w, int h)
+    : sprite(sprite_) {
     rect.x = x; rect.y = y; rect.w = w; rect.h = h;
 }
 
-Submarine::~Submarine() {
-    if (texture) SDL_DestroyTexture(texture);
-}
+Submarine::~Submarine() {}
 
 void Submarine::setPosition(int x, int y) {
     rect.x = x; rect.y = y;
@@ -32,23 +29,7 @@ void Submarine::clamp(int minX, int maxX, int minY, int maxY) {
     if (rect.y > maxY) rect.y = maxY;
 }
 
-void Submarine::render(SDL_Renderer* renderer) {
-    // Blink red if recently hit (alternating every 3 frames)
-    if (hitBlinkTimer > 0 && (hitBlinkTimer / 3) % 2 == 0) {
-        SDL_SetTextureColorMod(texture, 255, 100, 100);  // Red tint
-    } else {
-        SDL_SetTextureColorMod(texture, 255, 255, 255);  // Normal color
-    }
-    
-    // Flip based on facing direction
-    SDL_RendererFlip flip = facingRight ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
-    SDL_RenderCopyEx(renderer, texture, nullptr, &rect, 0, nullptr, flip);
-    
-    // Reset color mod
-    SDL_SetTextureColorMod(texture, 255, 255, 255);
-}
-
-SDL_Rect Submarine::getRect() const {
+SimRect Submarine::getRect() const {
     return rect;
 }
 
@@ -0,0 +1,149 @@
+#include "TextRenderer.h"
+#include "FontManager.h"
+#include "Profiler.h"
+#include "RenderStats.h"
+#include <iostream>
+
+TextRenderer::TextRenderer(SDL_Renderer* renderer, TTF_Font* font)
+    : renderer(renderer), atlas(nullptr)
+{
+    if (!font) {
+        std::cerr << "TextRenderer: no font given" << std::endl;
+        return;
+    }
+    atlas = FontManager::getAtlas(renderer, font);
+}
+
+int TextRenderer::measureRange(const std::string& text, size_t begin, size_t end) const {
+    int width = 0;
+    for (size_t i = begin; i < end; i++) {
+        const Glyph* g = getGlyph(text[i]);
+        if (g) width += g->advance;
+    }
+    return width;
+}
+
+void TextRenderer::wrapLines(const std::string& text, int wrapWidth, std::vector<Line>& out) const {
+    out.clear();
+
+    size_t lineStart = 0;
+    while (lineStart <= text.size()) {
+        size_t newline = text.find('\n', lineStart);
+        size_t paragraphEnd = (newline == std::string::npos) ? text.size() : newline;
+
+        // Greedy word wrap inside this paragraph
+        size_t begin = lineStart;
+        while (wrapWidth > 0 && measureRange(text, begin, paragraphEnd) > wrapWidth) {
+            size_t breakAt = std::string::npos;
+            int width = 0;
+            for (size_t i = begin; i < paragraphEnd; i++) {
+                const Glyph* g = getGlyph(text[i]);
+                if (g) width += g->advance;
+                if (width > wrapWidth) break;
+                if (text[i] == ' ') breakAt = i;
+            }
+
+            if (breakAt == std::string::npos || breakAt == begin) {
+                // One word wider than the box: break it where it overflows
+                size_t i = begin;
+                int w = 0;
+                while (i < paragraphEnd) {
+                    const Glyph* g = getGlyph(text[i]);
+                    int advance = g ? g->advance : 0;
+                    if (w + advance > wrapWidth && i > begin) break;
+                    w += advance;
+                    i++;
+                }
+                out.push_back({ begin, i });
+                begin = i;
+            } else {
+                out.push_back({ begin, breakAt });
+                begin = breakAt + 1;  // Drop the space we broke on
+            }
+        }
+        out.push_back({ begin, paragraphEnd });
+
+        if (newline == std::string::npos) break;
+        lineStart = newline + 1;
+    }
+}
+
+void TextRenderer::measure(const std::string& text, int* w, int* h) const {
+    if (w) *w = measureRange(text, 0, text.size());
+    if (h) *h = atlas ? atlas->fontHeight : 0;
+}
+
+void TextRenderer::measureWrapped(const std::string& text, int wrapWidth, int* w, int* h) const {
+    std::vector<Line> wrapped;
+    wrapLines(text, wrapWidth, wrapped);
+
+    int maxWidth = 0;
+    for (const Line& line : wrapped) {
+        int lineWidth = measureRange(text, line.begin, line.end);
+        if (lineWidth > maxWidth) maxWidth = lineWidth;
+    }
+    if (w) *w = maxWidth;
+    if (h) *h = atlas ? int(wrapped.size() - 1) * atlas->lineSkip + atlas->fontHeight : 0;
+}
+
+void TextRenderer::addQuads(const std::string& text, size_t begin, size_t end, float x, float y, SDL_Color color) {
+    const float texW = float(GlyphAtlas::WIDTH);
+    const float texH = float(atlas->height);
+
+    float penX = x;
+    for (size_t i = begin; i < end; i++) {
+        const Glyph* g = getGlyph(text[i]);
+        if (!g) continue;
+
+        if (text[i] != ' ' && g->src.w > 0) {
+            float x0 = penX, y0 = y;
+            float x1 = penX + g->src.w, y1 = y + g->src.h;
+            float u0 = g->src.x / texW, v0 = g->src.y / texH;
+            float u1 = (g->src.x + g->src.w) / texW, v1 = (g->src.y + g->src.h) / texH;
+
+            int base = int(vertices.size());
+            vertices.push_back({ { x0, y0 }, color, { u0, v0 } });
+            vertices.push_back({ { x1, y0 }, color, { u1, v0 } });
+            vertices.push_back({ { x1, y1 }, color, { u1, v1 } });
+            vertices.push_back({ { x0, y1 }, color, { u0, v1 } });
+
+            indices.push_back(base);
+            indices.push_back(base + 1);
+            indices.push_back(base + 2);
+            indices.push_back(base);
+            indices.push_back(base + 2);
+            indices.push_back(base + 3);
+        }
+        penX += g->advance;
+    }
+}
+
+void TextRenderer::flush() {
+    if (!vertices.empty()) {
+        RenderStats::geometry(renderer, atlas->texture,
+                           vertices.data(), int(vertices.size()),
+                           indices.data(), int(indices.size()));
+    }
+    vertices.clear();
+    indices.clear();
+}
+
+void TextRenderer::draw(const std::string& text, int x, int y, SDL_Color color) {
+    if (!isLoaded()) return;
+    PROFILE_ZONE("TextRenderer::draw");
+    addQuads(text, 0, text.size(), float(x), float(y), color);
+    flush();
+}
+
+void TextRenderer::drawWrapped(const std::string& text, int x, int y, SDL_Color color, int wrapWidth) {
+    if (!isLoaded()) return;
+    PROFILE_ZONE("TextRenderer::drawWrapped");
+
+    wrapLines(text, wrapWidth, lines);
+    float lineY = float(y);
+    for (const Line& line : lines) {
+        addQuads(text, line.begin, line.end, float(x), lineY, color);
+        lineY += atlas->lineSkip;
+    }
+    flush();
+}
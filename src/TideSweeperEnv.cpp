@@ -0,0 +1,257 @@
+#include "TideSweeperEnv.h"
+#include <algorithm>
+
+namespace {
+// Move per action % 9 (dx, dy)
+const int MOVES[TideSweeperEnv::MOVE_COUNT][2] = {
+    { 0, 0 }, { 0, -1 }, { 1, -1 }, { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }
+};
+}
+
+//  SINGLE ENVIRONMENT
+
+TideSweeperEnv::TideSweeperEnv(const SimConfig& config_, int maxSteps_, int actionRepeat_)
+    : config(config_), maxSteps(maxSteps_), actionRepeat(std::max(1, actionRepeat_)),
+      sim(nullptr), steps(0), done(false)
+{
+    reset(Rng::DEFAULT_SEED);
+}
+
+TideSweeperEnv::~TideSweeperEnv() {
+    delete sim;
+}
+
+void TideSweeperEnv::reset(uint64_t seed) {
+    // Reused between episodes: reset in place instead of a new Simulation
+    if (sim) sim->reset(seed);
+    else sim = new Simulation(config, seed);
+    steps = 0;
+    done = false;
+}
+
+SimInput TideSweeperEnv::actionToInput(int action) {
+    SimInput input;
+    if (action < 0 || action >= ACTION_COUNT) return input;
+    const int* move = MOVES[action % MOVE_COUNT];
+    input.left = move[0] < 0;
+    input.right = move[0] > 0;
+    input.up = move[1] < 0;
+    input.down = move[1] > 0;
+    input.calm = action >= MOVE_COUNT;
+    return input;
+}
+
+TideSweeperEnv::StepResult TideSweeperEnv::step(int action) {
+    StepResult result;
+    if (done) {
+        result.terminated = true;
+        return result;
+    }
+
+    SimInput input = actionToInput(action);
+    int scoreBefore = sim->getScore();
+    int livesBefore = sim->getLives();
+    for (int i = 0; i < actionRepeat && !sim->isGameOver(); i++) {
+        sim->step(input);
+    }
+    steps++;
+
+    result.reward = (sim->getScore() - scoreBefore) * REWARD_PER_POINT +
+                    (livesBefore - sim->getLives()) * REWARD_LIFE_LOST;
+    if (sim->isVictory()) result.reward += REWARD_VICTORY;
+
+    result.terminated = sim->isGameOver();
+    result.truncated = !result.terminated && steps >= maxSteps;
+    done = result.terminated || result.truncated;
+    return result;
+}
+
+void TideSweeperEnv::observe(float* out) const {
+    std::fill(out, out + OBS_SIZE, 0.0f);
+
+    const Level& level = sim->getLevel();
+    SimRect sub = sim->getSubmarine().getRect();
+    float subX = sub.x + sub.w / 2.0f;
+    float subY = sub.y + sub.h / 2.0f;
+
+    out[0] = subX / 800.0f;
+    out[1] = subY / 600.0f;
+    out[2] = sim->getLives() / 3.0f;
+    out[3] = (sim->getLevelNumber() - 1) / 3.0f;
+    if (level.hasBlackout()) {
+        out[4] = level.isPositionInBlackout((int)subX, (int)subY) ? 1.0f : 0.0f;
+    }
+    if (level.hasStorm()) {
+        out[5] = config.stormFrames > 0 ? level.getStormTimer() / float(config.stormFrames) : 0.0f;
+    }
+    float* slot = out + 6;
+
+    // Litter: the classic items and the Level 4 flow, nearest first.
+    // Index >= litterItems.size() means flow entity (index - size).
+    const std::vector<Litter>& items = level.getLitterItems();
+    const EntityStore& flow = level.getLitterFlow();
+    auto litterCenter = [&](int index, float& cx, float& cy) {
+        if (index < (int)items.size()) {
+            const Litter& l = items[index];
+            cx = l.x + l.getWidth() / 2.0f;
+            cy = l.y + l.getHeight() / 2.0f;
+        } else {
+            int f = index - (int)items.size();
+            cx = flow.x[f] + flow.width[f] / 2.0f;
+            cy = flow.y[f] + flow.height[f] / 2.0f;
+        }
+    };
+
+    nearest.clear();
+    for (int i = 0; i < (int)items.size(); i++) {
+        if (!items[i].active) continue;
+        float cx, cy;
+        litterCenter(i, cx, cy);
+        nearest.push_back({ (cx - subX) * (cx - subX) + (cy - subY) * (cy - subY), i });
+    }
+    for (int i = 0; i < flow.size(); i++) {
+        if (!(flow.flags[i] & EntityStore::FLAG_ACTIVE)) continue;
+        float cx, cy;
+        litterCenter((int)items.size() + i, cx, cy);
+        nearest.push_back({ (cx - subX) * (cx - subX) + (cy - subY) * (cy - subY), (int)items.size() + i });
+    }
+    int litterCount = std::min((int)nearest.size(), NEAREST_LITTER);
+    std::partial_sort(nearest.begin(), nearest.begin() + litterCount, nearest.end());
+    for (int k = 0; k < litterCount; k++) {
+        float cx, cy;
+        litterCenter(nearest[k].second, cx, cy);
+        slot[k * 3 + 0] = (cx - subX) / 800.0f;
+        slot[k * 3 + 1] = (cy - subY) / 600.0f;
+        slot[k * 3 + 2] = 1.0f;
+    }
+    slot += NEAREST_LITTER * 3;
+
+    // Animals, nearest first
+    const std::vector<Enemies>& enemies = level.getEnemyItems();
+    nearest.clear();
+    for (int i = 0; i < (int)enemies.size(); i++) {
+        const Enemies& e = enemies[i];
+        if (!e.active) continue;
+        float dx = e.x + e.width / 2.0f - subX;
+        float dy = e.y + e.height / 2.0f - subY;
+        nearest.push_back({ dx * dx + dy * dy, i });
+    }
+    int enemyCount = std::min((int)nearest.size(), NEAREST_ENEMIES);
+    std::partial_sort(nearest.begin(), nearest.begin() + enemyCount, nearest.end());
+    for (int k = 0; k < enemyCount; k++) {
+        const Enemies& e = enemies[nearest[k].second];
+        slot[k * 5 + 0] = (e.x + e.width / 2.0f - subX) / 800.0f;
+        slot[k * 5 + 1] = (e.y + e.height / 2.0f - subY) / 600.0f;
+        slot[k * 5 + 2] = 1.0f;
+        slot[k * 5 + 3] = (e.calmed || e.falling) ? 1.0f : 0.0f;
+        slot[k * 5 + 4] = (e.enemyType + 1) / float(ENEMY_TYPE_COUNT);
+    }
+}
+
+//  BATCHED ENVIRONMENTS
+
+VecEnv::VecEnv(int count, const SimConfig& config, int threadCount, int maxSteps, int actionRepeat)
+    : episodes(std::max(count, 1), 0), baseSeed(Rng::DEFAULT_SEED),
+      observations(std::max(count, 1) * TideSweeperEnv::OBS_SIZE, 0.0f),
+      rewards(std::max(count, 1), 0.0f), dones(std::max(count, 1), 0), truncated(std::max(count, 1), 0),
+      pendingActions(nullptr), job(Job::Reset), generation(0), busyWorkers(0), stopping(false)
+{
+    if (count < 1) count = 1;
+    for (int i = 0; i < count; i++) {
+        envs.push_back(new TideSweeperEnv(config, maxSteps, actionRepeat));
+    }
+
+    if (threadCount <= 0) threadCount = int(std::thread::hardware_concurrency());
+    chunkCount = std::max(1, std::min(threadCount, count));
+    for (int chunk = 1; chunk < chunkCount; chunk++) {
+        workers.emplace_back(&VecEnv::workerLoop, this, chunk);
+    }
+
+    reset(Rng::DEFAULT_SEED);
+}
+
+VecEnv::~VecEnv() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobReady.notify_all();
+    for (std::thread& t : workers) t.join();
+
+    for (TideSweeperEnv* env : envs) delete env;
+}
+
+void VecEnv::reset(uint64_t seed) {
+    baseSeed = seed;
+    std::fill(episodes.begin(), episodes.end(), 0);
+    runAll(Job::Reset);
+}
+
+void VecEnv::step(const int* actions) {
+    pendingActions = actions;
+    runAll(Job::Step);
+    pendingActions = nullptr;
+}
+
+void VecEnv::runJob(int chunk) {
+    // Contiguous slices, so each thread writes its own part of the arrays
+    int count = size();
+    int begin = count * chunk / chunkCount;
+    int end = count * (chunk + 1) / chunkCount;
+    uint64_t stride = uint64_t(count);
+
+    for (int i = begin; i < end; i++) {
+        TideSweeperEnv& env = *envs[i];
+        if (job == Job::Reset) {
+            env.reset(baseSeed + uint64_t(i));
+            rewards[i] = 0.0f;
+            dones[i] = 0;
+            truncated[i] = 0;
+        } else {
+            TideSweeperEnv::StepResult result = env.step(pendingActions[i]);
+            rewards[i] = result.reward;
+            dones[i] = (result.terminated || result.truncated) ? 1 : 0;
+            truncated[i] = result.truncated ? 1 : 0;
+            if (dones[i]) {
+                episodes[i]++;
+                env.reset(baseSeed + uint64_t(i) + stride * uint64_t(episodes[i]));
+            }
+        }
+        env.observe(&observations[size_t(i) * TideSweeperEnv::OBS_SIZE]);
+    }
+}
+
+void VecEnv::runAll(Job newJob) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = newJob;
+        generation++;
+        busyWorkers = (int)workers.size();
+    }
+    jobReady.notify_all();
+
+    runJob(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [this] { return busyWorkers == 0; });
+}
+
+void VecEnv::workerLoop(int chunk) {
+    unsigned seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobReady.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+
+        runJob(chunk);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busyWorkers--;
+        }
+        jobDone.notify_one();
+    }
+}
@@ -1,18 +1,13 @@
 #include "VictoryScreen.h"
 #include <SDL_image.h>
 #include <iostream>
+#include "AssetCache.h"
+#include "FontManager.h"
+#include "RenderStats.h"
 
 VictoryScreen::VictoryScreen(SDL_Renderer* renderer)
     : renderer(renderer), hoveredIndex(-1)
 {
-    fontLarge = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 48);
-    fontSmall = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 28);
-
-    if (!fontLarge || !fontSmall) {
-        std::cerr << "VictoryScreen Font Load Error: "
-                  << TTF_GetError() << std::endl;
-    }
-
     int bw = 220;
     int bh = 50;
 
@@ -22,32 +17,24 @@ VictoryScreen::VictoryScreen(SDL_Renderer* renderer)
 
     charsPerSecond = 55;
 
-    fontTitle  = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 52);
-    fontStats  = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 32);
-    fontHeader = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 32);
-    fontBody   = TTF_OpenFont("Assets/fonts/OpenSans.ttf", 24);
+    fontTitle  = FontManager::get(UI_FONT_PATH, 52);
+    fontStats  = FontManager::get(UI_FONT_PATH, 32);
+    fontBody   = FontManager::get(UI_FONT_PATH, 24);
 
-    if (!fontTitle || !fontStats || !fontHeader || !fontBody) {
-    std::cerr << "VictoryScreen font failed to load: " << TTF_GetError() << std::endl;
-    }
+    titleText = new TextRenderer(renderer, fontTitle);
+    statsText = new TextRenderer(renderer, fontStats);
+    bodyText  = new TextRenderer(renderer, fontBody);
 
-    bgTexture = IMG_LoadTexture(renderer, "Assets/backgrounds/victory_background.png");
-    if (!bgTexture) {
-        std::cerr << "Failed to load victory background: " << IMG_GetError() << std::endl;
-    }
+    bgTexture = AssetCache::acquireTexture(renderer, "Assets/backgrounds/victory_background.png");
 
 }
 
 VictoryScreen::~VictoryScreen() {
-    if (fontLarge) TTF_CloseFont(fontLarge);
-    if (fontSmall) TTF_CloseFont(fontSmall);
-
-    if (fontTitle)  TTF_CloseFont(fontTitle);
-    if (fontStats)  TTF_CloseFont(fontStats);
-    if (fontHeader) TTF_CloseFont(fontHeader);
-    if (fontBody)   TTF_CloseFont(fontBody);
+    delete titleText;
+    delete statsText;
+    delete bodyText;
 
-    if (bgTexture) SDL_DestroyTexture(bgTexture);
+    AssetCache::release(bgTexture);
 
 }
 
@@ -65,22 +52,22 @@ void VictoryScreen::render(float countdownRatio, int finalScore)
     // Draw background
     if (bgTexture) {
         SDL_Rect dest = {0, 0, 800, 600};
-        SDL_RenderCopy(renderer, bgTexture, NULL, &dest);
+        RenderStats::copy(renderer, bgTexture, NULL, &dest);
     } else {
         // fallback if failed to load
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
         SDL_Rect bg = {0, 0, 800, 600};
-        SDL_RenderFillRect(renderer, &bg);
+        RenderStats::fillRect(renderer, &bg);
     }
 
     // Transparent Victory Panel 
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 120);   // semi-transparent black
     SDL_Rect panel = { 0, 0, 800, 600 };
-    SDL_RenderFillRect(renderer, &panel);
+    RenderStats::fillRect(renderer, &panel);
 
 
-    SDL_Color white = {255,255,255};
-    SDL_Color gold  = {255,215,0};
+    SDL_Color white = {255,255,255,255};
+    SDL_Color gold  = {255,215,0,255};
 
     int y;
     // STATIC elements — fixed positions
@@ -95,18 +82,14 @@ void VictoryScreen::render(float countdownRatio, int finalScore)
     // 1. TITLE (large, centered)
     {
         y = 50;
-        SDL_Surface* surf = TTF_RenderText_Blended(fontTitle, "Mission Successful!", gold);
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-        SDL_Rect r = { (800 - surf->w)/2, y, surf->w, surf->h };
-        SDL_RenderCopy(renderer, tex, NULL, &r);
+        int w = 0, h = 0;
+        titleText->measure("Mission Successful!", &w, &h);
+        titleText->draw("Mission Successful!", (800 - w)/2, y, gold);
 
-        int statsY = y + surf->h - 60;
+        int statsY = y + h - 60;
 
         y = statsY + 70; // move rest of layout below stats
 
-        SDL_FreeSurface(surf);
-        SDL_DestroyTexture(tex);
-
     }
 
 
@@ -116,54 +99,35 @@ void VictoryScreen::render(float countdownRatio, int finalScore)
             std::string score = "Final Score: " + std::to_string(finalScore);
         std::string rank  = "Rank Earned: TideSweeper Hero";
 
-        SDL_Surface* s1 = TTF_RenderText_Blended(fontStats, score.c_str(), white);
-        SDL_Surface* s2 = TTF_RenderText_Blended(fontStats, rank.c_str(), white);
-
-        SDL_Texture* t1 = SDL_CreateTextureFromSurface(renderer, s1);
-        SDL_Texture* t2 = SDL_CreateTextureFromSurface(renderer, s2);
+        int w1 = 0, h1 = 0, w2 = 0, h2 = 0;
+        statsText->measure(score, &w1, &h1);
+        statsText->measure(rank, &w2, &h2);
 
         // CENTER HORIZONTALLY
-        int scoreX = (800 - s1->w) / 2;
-        int rankX  = (800 - s2->w) / 2;
+        int scoreX = (800 - w1) / 2;
+        int rankX  = (800 - w2) / 2;
 
-        SDL_Rect r1 = { scoreX, y, s1->w, s1->h };
-        SDL_Rect r2 = { rankX,  y + s1->h + 10, s2->w, s2->h };
+        SDL_Rect r1 = { scoreX, y, w1, h1 };
+        SDL_Rect r2 = { rankX,  y + h1 + 10, w2, h2 };
 
-        SDL_RenderCopy(renderer, t1, nullptr, &r1);
-        SDL_RenderCopy(renderer, t2, nullptr, &r2);
+        statsText->draw(score, r1.x, r1.y, white);
+        statsText->draw(rank, r2.x, r2.y, white);
 
         y = r2.y + r2.h + 40;
-
-        SDL_FreeSurface(s1);
-        SDL_FreeSurface(s2);
-        SDL_DestroyTexture(t1);
-        SDL_DestroyTexture(t2);
     }
 
 
     // TYPEWRITER BODY TEXT
     {
         if (!typedText.empty()) {
-            SDL_Surface* surf = TTF_RenderText_Blended_Wrapped(fontBody, typedText.c_str(), white, wrapWidth);
-            if (!surf) {
-                std::cerr << "TTF Error: " << TTF_GetError() << std::endl;
-                return;
-            }
-            SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-
-            SDL_Rect r = {
+            int w = 0, h = 0;
+            bodyText->measureWrapped(typedText, wrapWidth, &w, &h);
+            bodyText->drawWrapped(typedText,
                 centerX,   // <-- horizontally centered
                 y - 20,
-                surf->w,
-                surf->h
-            };
-
-            SDL_RenderCopy(renderer, tex, NULL, &r);
+                white, wrapWidth);
 
-            y += surf->h + 40;
-
-            SDL_FreeSurface(surf);
-            SDL_DestroyTexture(tex);
+            y += h + 40;
         }
 
     }
@@ -171,22 +135,12 @@ void VictoryScreen::render(float countdownRatio, int finalScore)
 
     // CLOSING LINE (centered, medium size)
     {
-        SDL_Surface* surf = TTF_RenderText_Blended(fontStats, "Excellent work out there.", white);
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
-
-        SDL_Rect r = {
-        centerX + (wrapWidth - surf->w)/2,  // <-- centered inside same block width
-        closingLineY,
-        surf->w,
-        surf->h
-        
-        };
-
-
-        SDL_RenderCopy(renderer, tex, NULL, &r);
-
-        SDL_FreeSurface(surf);
-        SDL_DestroyTexture(tex);
+        int w = 0, h = 0;
+        statsText->measure("Excellent work out there.", &w, &h);
+        statsText->draw("Excellent work out there.",
+            centerX + (wrapWidth - w)/2,  // <-- centered inside same block width
+            closingLineY,
+            white);
     }
 
 
@@ -215,19 +169,14 @@ void VictoryScreen::render(float countdownRatio, int finalScore)
                 (index == hoveredIndex ? 215 : 80),
                 (index == hoveredIndex ? 0   : 160),
                 255);
-            SDL_RenderFillRect(renderer, &b.rect);
-
-            SDL_Surface* txt = TTF_RenderText_Blended(fontStats, b.label.c_str(), white);
-            SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, txt);
-            SDL_Rect lr = {
-                b.rect.x + (b.rect.w - txt->w)/2,
-                b.rect.y + (b.rect.h - txt->h)/2,
-                txt->w, txt->h
-            };
-            SDL_RenderCopy(renderer, tex, NULL, &lr);
-
-            SDL_FreeSurface(txt);
-            SDL_DestroyTexture(tex);
+            RenderStats::fillRect(renderer, &b.rect);
+
+            int w = 0, h = 0;
+            statsText->measure(b.label, &w, &h);
+            statsText->draw(b.label,
+                b.rect.x + (b.rect.w - w)/2,
+                b.rect.y + (b.rect.h - h)/2,
+                white);
         };
 
         drawBtn(restartBtn, 0);
@@ -236,27 +185,15 @@ void VictoryScreen::render(float countdownRatio, int finalScore)
 
     // FOOTER CREDIT (tiny text at the bottom)
     {
-        SDL_Color gray = {200, 200, 200};
-
-        SDL_Surface* creditSurf =
-            TTF_RenderText_Blended(fontBody, "Created by Laura, Mari, and Sara", gray);
-
-        if (creditSurf) {
-            SDL_Texture* creditTex =
-                SDL_CreateTextureFromSurface(renderer, creditSurf);
-
-            SDL_Rect creditRect = {
-                (800 - creditSurf->w) / 2,  // centered
-                550,                        // bottom of window
-                creditSurf->w,
-                creditSurf->h
-            };
-
-            SDL_RenderCopy(renderer, creditTex, nullptr, &creditRect);
-
-            SDL_FreeSurface(creditSurf);
-            SDL_DestroyTexture(creditTex);
-        }
+        SDL_Color gray = {200, 200, 200, 255};
+        const std::string credit = "Created by Laura, Mari, and Sara";
+
+        int w = 0, h = 0;
+        bodyText->measure(credit, &w, &h);
+        bodyText->draw(credit,
+            (800 - w) / 2,  // centered
+            550,            // bottom of window
+            gray);
     }
 
 }
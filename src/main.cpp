@@ -5,7 +5,12 @@
 #include <SDL_mixer.h>
 #include <iostream>
 #include <memory>
+#include <string>
 #include "GameManager.h"
+#include "InputRecording.h"
+#include "FontManager.h"
+#include "AssetCache.h"
+#include "Profiler.h"
 
 namespace {
     // RAII helper to ensure SDL subsystems are properly cleaned up
@@ -26,8 +31,7 @@ namespace {
                 return;
             }
 
-            if (TTF_Init() < 0) {
-                std::cerr << "SDL_ttf init failed: " << TTF_GetError() << std::endl;
+            if (!FontManager::init()) {
                 IMG_Quit();
                 SDL_Quit();
                 success = false;
@@ -37,7 +41,7 @@ namespace {
 
         ~SDLInitializer() {
             Mix_CloseAudio();
-            TTF_Quit();
+            FontManager::shutdown();  // Closes every font, then TTF_Quit
             IMG_Quit();
             SDL_Quit();
         }
@@ -57,10 +61,10 @@ namespace {
     }
 
     // Helper to create renderer and handle errors
-    SDL_Renderer* createRenderer(SDL_Window* window) {
+    SDL_Renderer* createRenderer(SDL_Window* window, bool vsync) {
         SDL_Renderer* renderer = SDL_CreateRenderer(
             window, -1,
-            SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+            SDL_RENDERER_ACCELERATED | (vsync ? SDL_RENDERER_PRESENTVSYNC : 0));
 
         if (!renderer) {
             std::cerr << "Renderer creation failed: " << SDL_GetError() << std::endl;
@@ -70,6 +74,33 @@ namespace {
 }
 
 int main(int argc, char* argv[]) {
+    PROFILE_THREAD_NAME("Main");
+
+    // --record <file>: save each game's inputs when it ends (game 2 goes
+    //                  to <file>-2, and so on)
+    // --replay <file>: play a recorded session back
+    // --autopilot:     the bot plays, game after game (soak tests)
+    // --uncapped:      with --autopilot, no vsync and one tick per frame
+    std::string recordPath, replayPath;
+    bool autopilot = false, uncapped = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (arg == "--autopilot") {
+            autopilot = true;
+        } else if (arg == "--uncapped") {
+            uncapped = true;
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--record <file>] [--replay <file>] [--autopilot [--uncapped]]" << std::endl;
+            return 1;
+        }
+    }
+    uncapped = uncapped && autopilot;
+
     // Initialize SDL and all subsystems
     SDLInitializer sdl;
     if (!sdl.success) {
@@ -82,24 +113,46 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    SDL_Renderer* renderer = createRenderer(window);
+    SDL_Renderer* renderer = createRenderer(window, !uncapped);
     if (!renderer) {
         SDL_DestroyWindow(window);
         return 1;
     }
 
-    // Run the game
+    // Run the game. Each trip back to the menu makes a new GameManager;
+    // its images and sounds come from AssetCache, loaded once per process.
 bool keepRunning = true;
+    int gameNumber = 0;
 
     while (keepRunning) {
         GameManager game(window, renderer);
+        gameNumber++;
+        if (!recordPath.empty()) {
+            game.recordTo(InputRecording::pathForGame(recordPath, gameNumber));
+        }
+        if (autopilot) {
+            game.setAutopilot(uncapped);
+        }
+        if (!replayPath.empty()) {
+            // Only the first game; back at the menu it's the player's turn
+            game.replayFrom(replayPath);
+            replayPath.clear();
+        }
         game.run();
 
         // If GameManager ended because player clicked Exit:
         keepRunning = game.isRunning();  
     }
 
-    // Cleanup (SDLInitializer handles subsystem cleanup)
+#if TS_PROFILING
+    // Last few seconds of the session, for chrome://tracing or Perfetto
+    Profiler::writeChromeTrace(PROFILE_TRACE_PATH);
+#endif
+
+    // Cleanup (SDLInitializer handles subsystem cleanup). Cached textures
+    // need the renderer and cached sounds the audio device, so they go first.
+    AssetCache::shutdown();
+    FontManager::releaseAtlases();
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     return 0;
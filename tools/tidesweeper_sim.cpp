@@ -0,0 +1,187 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "BalanceSim.h"
+
+// tidesweeper-sim: plays many headless games across all cores and writes
+// per-run stats, for balancing without playing by hand.
+//
+//   tidesweeper-sim --runs 10000 --policy chase --csv runs.csv
+//   tidesweeper-sim --enemy-speeds 7,7,6,6,4 --max-enemies 3 --json runs.json
+
+namespace {
+
+void printUsage(const char* exe) {
+    std::cerr
+        << "Usage: " << exe << " [options]\n"
+        << "  --runs <n>                 games to play (default 1000)\n"
+        << "  --seed <n>                 first seed; run i uses seed + i (default 1)\n"
+        << "  --policy <name>            idle, random, chase or autopilot (default random)\n"
+        << "  --threads <n>              worker threads (default: one per core)\n"
+        << "  --max-seconds <n>          give up on a game after this long (default 600)\n"
+        << "  --csv <file>               per-run stats as CSV\n"
+        << "  --json <file>              per-run stats and settings as JSON\n"
+        << "Balance:\n"
+        << "  --enemy-speeds a,b,c,d,e   swordfish, eel, octopus, angler, shark\n"
+        << "  --spawn-interval <frames>  Levels 2-3\n"
+        << "  --max-enemies <n>          Levels 2-3\n"
+        << "  --storm-spawn-interval <frames>\n"
+        << "  --storm-max-enemies <n>\n"
+        << "  --storm-seconds <n>        Level 4 length\n";
+}
+
+bool parseInt(const std::string& text, int& value) {
+    char* end = nullptr;
+    long v = std::strtol(text.c_str(), &end, 10);
+    if (end == text.c_str() || *end != '\0') return false;
+    value = int(v);
+    return true;
+}
+
+bool parseSpeeds(const std::string& text, std::vector<float>& speeds) {
+    std::vector<float> parsed;
+    std::stringstream list(text);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        char* end = nullptr;
+        float v = std::strtof(item.c_str(), &end);
+        if (end == item.c_str() || *end != '\0') return false;
+        parsed.push_back(v);
+    }
+    if (parsed.size() != speeds.size()) return false;
+    speeds = parsed;
+    return true;
+}
+
+// Mean of the values that aren't -1, and how many there were
+void meanOf(const std::vector<int>& values, double& mean, int& count) {
+    double sum = 0.0;
+    count = 0;
+    for (int v : values) {
+        if (v < 0) continue;
+        sum += v;
+        count++;
+    }
+    mean = count ? sum / count : 0.0;
+}
+
+void printSummary(const std::vector<BalanceSim::RunStats>& runs, double wallSeconds) {
+    const char* enemyNames[ENEMY_TYPE_COUNT] = { "Swordfish", "Eel", "Octopus", "Angler", "Shark" };
+    int n = int(runs.size());
+    long long totalTicks = 0;
+    int victories = 0, gameOvers = 0;
+    long long missed = 0;
+    long long lives[ENEMY_TYPE_COUNT] = {};
+    std::vector<int> levelTicks[3], level4Scores;
+    for (const BalanceSim::RunStats& r : runs) {
+        totalTicks += r.ticks;
+        victories += r.victory;
+        gameOvers += r.gameOver;
+        missed += r.litterMissed;
+        for (int t = 0; t < ENEMY_TYPE_COUNT; t++) lives[t] += r.livesLost[t];
+        for (int l = 0; l < 3; l++) levelTicks[l].push_back(r.levelTicks[l]);
+        level4Scores.push_back(r.level4Score);
+    }
+
+    std::cout << n << " games, " << totalTicks / 60.0 << " game-seconds in " << wallSeconds << " s ("
+              << (wallSeconds > 0.0 ? totalTicks / 60.0 / wallSeconds : 0.0) << " game-seconds/s)\n";
+    std::cout << "Victory " << 100.0 * victories / n << "%, game over " << 100.0 * gameOvers / n << "%\n";
+
+    const int thresholds[3] = { 100, 200, 400 };
+    for (int l = 0; l < 3; l++) {
+        double mean;
+        int count;
+        meanOf(levelTicks[l], mean, count);
+        std::cout << "Level " << l + 2 << " (" << thresholds[l] << " pts): reached by "
+                  << 100.0 * count / n << "%, mean " << mean / 60.0 << " s\n";
+    }
+
+    std::cout << "Lives lost per game:";
+    for (int t = 0; t < ENEMY_TYPE_COUNT; t++) {
+        std::cout << ' ' << enemyNames[t] << ' ' << double(lives[t]) / n;
+    }
+    std::cout << "\nLitter missed per game: " << double(missed) / n << '\n';
+
+    double mean;
+    int count;
+    meanOf(level4Scores, mean, count);
+    std::cout << "Level 4 final score: mean " << mean << " over " << count << " games\n";
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    BalanceSim::Options options;
+    std::string csvPath, jsonPath;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        }
+
+        bool hasValue = i + 1 < argc;
+        std::string value = hasValue ? argv[i + 1] : "";
+        int number = 0;
+        bool ok = hasValue;
+
+        if (arg == "--runs") ok = ok && parseInt(value, options.runs) && options.runs > 0;
+        else if (arg == "--seed") {
+            ok = ok && parseInt(value, number) && number >= 0;
+            options.seed = uint64_t(number);
+        }
+        else if (arg == "--policy") ok = ok && BalanceSim::parsePolicy(value, options.policy);
+        else if (arg == "--threads") ok = ok && parseInt(value, options.threads);
+        else if (arg == "--max-seconds") {
+            ok = ok && parseInt(value, number) && number > 0;
+            options.maxTicks = number * 60;
+        }
+        else if (arg == "--csv") csvPath = value;
+        else if (arg == "--json") jsonPath = value;
+        else if (arg == "--enemy-speeds") ok = ok && parseSpeeds(value, options.config.enemySpeeds);
+        else if (arg == "--spawn-interval") ok = ok && parseInt(value, options.config.spawnInterval);
+        else if (arg == "--max-enemies") ok = ok && parseInt(value, options.config.maxActiveEnemies);
+        else if (arg == "--storm-spawn-interval") ok = ok && parseInt(value, options.config.stormSpawnInterval);
+        else if (arg == "--storm-max-enemies") ok = ok && parseInt(value, options.config.stormMaxActiveEnemies);
+        else if (arg == "--storm-seconds") {
+            ok = ok && parseInt(value, number) && number > 0;
+            options.config.stormFrames = number * 60;
+        }
+        else ok = false;
+
+        if (!ok) {
+            std::cerr << "Bad argument: " << arg << (hasValue ? " " + value : "") << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<BalanceSim::RunStats> runs = BalanceSim::runBatch(options);
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printSummary(runs, wallSeconds);
+
+    if (!csvPath.empty()) {
+        std::ofstream csv(csvPath);
+        if (!csv) {
+            std::cerr << "Could not write " << csvPath << std::endl;
+            return 1;
+        }
+        BalanceSim::writeCsv(csv, runs);
+    }
+    if (!jsonPath.empty()) {
+        std::ofstream json(jsonPath);
+        if (!json) {
+            std::cerr << "Could not write " << jsonPath << std::endl;
+            return 1;
+        }
+        BalanceSim::writeJson(json, options, runs);
+    }
+    return 0;
+}